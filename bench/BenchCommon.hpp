@@ -0,0 +1,119 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+
+// ======================================= 基准测试辅助 ======================================= //
+namespace NekiraBench
+{
+
+// 已注册的基准
+struct BenchCase
+{
+    const char* Name = nullptr;
+    void (*Run)() = nullptr;
+
+    // 在其他基准之后运行，用于会改变全局状态(如封存注册表)的基准
+    bool bRunLast = false;
+};
+
+inline std::vector<BenchCase>& GetCases()
+{
+    static std::vector<BenchCase> Cases;
+    return Cases;
+}
+
+struct BenchRegistrar
+{
+    BenchRegistrar(const char* Name, void (*Run)(), bool bRunLast = false)
+    {
+        GetCases().push_back(BenchCase{Name, Run, bRunLast});
+    }
+};
+
+// 阻止编译器优化掉Value的计算
+template <typename Type>
+inline void DoNotOptimize(const Type& Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(Value) : "memory");
+#else
+    static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&Value)));
+#endif
+}
+
+// 执行Body(Iterations)若干轮，返回最快一轮中每次迭代的纳秒数
+template <typename Body>
+double MeasureNs(size_t Iterations, Body&& Function, int Rounds = 5)
+{
+    double Best = 0.0;
+
+    for (int Round = 0; Round < Rounds; ++Round)
+    {
+        const auto Start = std::chrono::steady_clock::now();
+        Function(Iterations);
+        const auto End = std::chrono::steady_clock::now();
+
+        const double Elapsed = std::chrono::duration<double, std::nano>(End - Start).count() / Iterations;
+        Best = Round == 0 ? Elapsed : std::min(Best, Elapsed);
+    }
+
+    return Best;
+}
+
+// 输出一行结果
+inline void Report(std::string_view Bench, std::string_view Case, double NsPerOp)
+{
+    std::printf("%-28.*s %-40.*s %10.2f ns/op\n", static_cast<int>(Bench.size()), Bench.data(),
+                static_cast<int>(Case.size()), Case.data(), NsPerOp);
+}
+
+// 输出一行比值或比例
+inline void ReportRatio(std::string_view Bench, std::string_view Case, double Ratio, std::string_view Unit)
+{
+    std::printf("%-28.*s %-40.*s %10.2f %.*s\n", static_cast<int>(Bench.size()), Bench.data(),
+                static_cast<int>(Case.size()), Case.data(), Ratio, static_cast<int>(Unit.size()), Unit.data());
+}
+
+} // namespace NekiraBench
+
+// 注册一个基准，运行时按名称过滤
+#define NEKIRA_BENCH(BenchName)                                                                                        \
+    static void NekiraBench_##BenchName();                                                                             \
+    static const NekiraBench::BenchRegistrar NekiraBenchRegistrar_##BenchName(#BenchName, &NekiraBench_##BenchName);   \
+    static void NekiraBench_##BenchName()
+
+// 注册一个在其他基准之后运行的基准
+#define NEKIRA_BENCH_LAST(BenchName)                                                                                   \
+    static void NekiraBench_##BenchName();                                                                             \
+    static const NekiraBench::BenchRegistrar NekiraBenchRegistrar_##BenchName(#BenchName, &NekiraBench_##BenchName,    \
+                                                                              true);                                   \
+    static void NekiraBench_##BenchName()
@@ -0,0 +1,174 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <string>
+#include <vector>
+
+
+// CopyObject的复制计划与逐成员复制、手写复制的对比，mixed为7个标量成员与std::string、std::vector成员
+namespace
+{
+struct ScalarRecord
+{
+    int      Id = 0;
+    float    X = 0.0f;
+    float    Y = 0.0f;
+    float    Z = 0.0f;
+    double   Mass = 0.0;
+    uint32_t Flags = 0;
+    int      Health = 0;
+    double   Scale = 0.0;
+};
+
+struct MixedRecord
+{
+    int                Id = 0;
+    float              X = 0.0f;
+    float              Y = 0.0f;
+    float              Z = 0.0f;
+    std::string        Name;
+    double             Mass = 0.0;
+    uint32_t           Flags = 0;
+    int                Health = 0;
+    std::vector<float> Weights;
+};
+
+void RegisterRecords()
+{
+    auto ScalarInfo = NekiraReflect::MakeClassTypeInfo<ScalarRecord>("CopyBenchScalarRecord");
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Id", &ScalarRecord::Id));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("X", &ScalarRecord::X));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Y", &ScalarRecord::Y));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Z", &ScalarRecord::Z));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Mass", &ScalarRecord::Mass));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Flags", &ScalarRecord::Flags));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Health", &ScalarRecord::Health));
+    ScalarInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Scale", &ScalarRecord::Scale));
+    NekiraReflect::RegisterClassInfo(std::move(ScalarInfo));
+
+    auto MixedInfo = NekiraReflect::MakeClassTypeInfo<MixedRecord>("CopyBenchMixedRecord");
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Id", &MixedRecord::Id));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("X", &MixedRecord::X));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Y", &MixedRecord::Y));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Z", &MixedRecord::Z));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &MixedRecord::Name));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Mass", &MixedRecord::Mass));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Flags", &MixedRecord::Flags));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Health", &MixedRecord::Health));
+    MixedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Weights", &MixedRecord::Weights));
+    NekiraReflect::RegisterClassInfo(std::move(MixedInfo));
+}
+
+// 不使用复制计划时逐个成员复制所需的偏移与类型操作表，在计时之前解析
+struct FieldCopy
+{
+    uint32_t                      Offset = 0;
+    const NekiraReflect::TypeOps* Ops = nullptr;
+};
+
+std::vector<FieldCopy> ResolveFieldCopies(const NekiraReflect::ClassTypeInfo* ClassInfo)
+{
+    std::vector<FieldCopy> Result;
+
+    for (const auto& Field : ClassInfo->GetFields())
+    {
+        Result.push_back(FieldCopy{Field.Offset, ClassInfo->GetVariable(Field.Name)->GetTypeOps()});
+    }
+
+    return Result;
+}
+
+void CopyPerField(const std::vector<FieldCopy>& Fields, void* Dst, const void* Src)
+{
+    for (const auto& Field : Fields)
+    {
+        Field.Ops->Copy(static_cast<char*>(Dst) + Field.Offset, static_cast<const char*>(Src) + Field.Offset);
+    }
+}
+
+template <typename RecordType, typename SetupFunc>
+void MeasureCopies(const char* Case, SetupFunc&& Setup)
+{
+    const auto* ClassInfo = NekiraReflect::GetNClass<RecordType>();
+
+    constexpr size_t Iterations = 1'000'000;
+
+    RecordType Src;
+    RecordType Dst;
+    Setup(Src);
+
+    // 首次调用构建复制计划
+    ClassInfo->CopyObject(&Dst, &Src);
+
+    const std::vector<FieldCopy> Fields = ResolveFieldCopies(ClassInfo);
+
+    const double HandWritten = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Src);
+            Dst = Src;
+            NekiraBench::DoNotOptimize(Dst);
+        }
+    });
+
+    const double Planned = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            ClassInfo->CopyObject(&Dst, &Src);
+            NekiraBench::DoNotOptimize(Dst);
+        }
+    });
+
+    const double PerField = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            CopyPerField(Fields, &Dst, &Src);
+            NekiraBench::DoNotOptimize(Dst);
+        }
+    });
+
+    NekiraBench::Report("CopyObject", std::string("hand-written operator=, ") + Case, HandWritten);
+    NekiraBench::Report("CopyObject", std::string("CopyObject, ") + Case, Planned);
+    NekiraBench::Report("CopyObject", std::string("per-field TypeOps::Copy, ") + Case, PerField);
+}
+} // namespace
+
+NEKIRA_BENCH(CopyObject)
+{
+    RegisterRecords();
+
+    MeasureCopies<ScalarRecord>("8 scalars", [](ScalarRecord& Record) {
+        Record.Id = 7;
+        Record.Mass = 2.5;
+    });
+
+    MeasureCopies<MixedRecord>("mixed", [](MixedRecord& Record) {
+        Record.Id = 7;
+        Record.Name = "a string long enough to live on the heap";
+        Record.Weights.assign(16, 0.5f);
+    });
+}
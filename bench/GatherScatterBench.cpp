@@ -0,0 +1,197 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Batch/FieldGatherScatter.hpp>
+#include <NekiraReflect/DynamicReflect/Batch/FieldKernels.hpp>
+#include <NekiraReflect/DynamicReflect/Batch/ObjectSpan.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <string>
+#include <vector>
+
+
+// 在10万个对象上收集、分发一个float成员，比较AVX2与标量实现，以及逐对象GetValue/SetValue的循环
+namespace
+{
+struct GatherEntity
+{
+    int    Id = 0;
+    float  Health = 0.0f;
+    double Position[3] = {};
+    char   Tag[12] = {};
+};
+
+void RegisterGatherEntity()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<GatherEntity>("GatherBenchEntity");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Id", &GatherEntity::Id));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Health", &GatherEntity::Health));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+const char* GetInstructionSetName(NekiraReflect::BatchInstructionSet InstructionSet)
+{
+    return InstructionSet == NekiraReflect::BatchInstructionSet::AVX2 ? "AVX2" : "scalar";
+}
+} // namespace
+
+NEKIRA_BENCH(GatherScatter)
+{
+    RegisterGatherEntity();
+
+    const auto* VarInfo = NekiraReflect::GetNClass<GatherEntity>()->GetVariable("Health");
+
+    constexpr size_t EntityCount = 100'000;
+
+    std::vector<GatherEntity> Entities(EntityCount);
+    std::vector<float>        Health(EntityCount);
+
+    for (size_t Index = 0; Index < EntityCount; ++Index)
+    {
+        Entities[Index].Health = static_cast<float>(Index);
+    }
+
+    const NekiraReflect::ObjectSpan Objects = NekiraReflect::MakeObjectSpan(Entities);
+
+    const NekiraReflect::BatchInstructionSet Supported = NekiraReflect::GetBatchInstructionSet();
+
+    // 逐对象经成员信息读写，作为对照
+    const double GetValueLoop = NekiraBench::MeasureNs(EntityCount, [&](size_t Count) {
+        for (size_t Index = 0; Index < Count; ++Index)
+        {
+            Health[Index] = VarInfo->GetValue<float>(&Entities[Index]);
+        }
+
+        NekiraBench::DoNotOptimize(Health.data());
+    });
+
+    const double SetValueLoop = NekiraBench::MeasureNs(EntityCount, [&](size_t Count) {
+        for (size_t Index = 0; Index < Count; ++Index)
+        {
+            VarInfo->SetValue(&Entities[Index], Health[Index]);
+        }
+
+        NekiraBench::DoNotOptimize(Entities.data());
+    });
+
+    NekiraBench::Report("GatherScatter", "GetValue loop", GetValueLoop);
+    NekiraBench::Report("GatherScatter", "SetValue loop", SetValueLoop);
+
+    using NekiraReflect::BatchInstructionSet;
+
+    for (const auto InstructionSet : {BatchInstructionSet::Scalar, BatchInstructionSet::AVX2})
+    {
+        if (InstructionSet == BatchInstructionSet::AVX2 && Supported != InstructionSet)
+        {
+            continue;
+        }
+
+        NekiraReflect::SetBatchInstructionSet(InstructionSet);
+
+        const std::string Suffix = std::string(", ") + GetInstructionSetName(InstructionSet);
+
+        const double Gather = NekiraBench::MeasureNs(EntityCount, [&](size_t) {
+            NekiraReflect::GatherField(Objects, VarInfo, Health.data());
+            NekiraBench::DoNotOptimize(Health.data());
+        });
+
+        const double Scatter = NekiraBench::MeasureNs(EntityCount, [&](size_t) {
+            NekiraReflect::ScatterField(Objects, VarInfo, Health.data());
+            NekiraBench::DoNotOptimize(Entities.data());
+        });
+
+        NekiraBench::Report("GatherScatter", "GatherField" + Suffix, Gather);
+        NekiraBench::Report("GatherScatter", "ScatterField" + Suffix, Scatter);
+    }
+
+    NekiraReflect::SetBatchInstructionSet(Supported);
+}
+
+// 对float成员求和与求最值，比较AVX2与标量实现，以及按步长逐元素的循环；4096个对象在缓存中，10万个对象受内存带宽限制
+NEKIRA_BENCH(FieldKernels)
+{
+    if (NekiraReflect::GetNClass<GatherEntity>() == nullptr)
+    {
+        RegisterGatherEntity();
+    }
+
+    const auto* VarInfo = NekiraReflect::GetNClass<GatherEntity>()->GetVariable("Health");
+
+    const NekiraReflect::BatchInstructionSet Supported = NekiraReflect::GetBatchInstructionSet();
+
+    using NekiraReflect::BatchInstructionSet;
+
+    for (const size_t EntityCount : {size_t{4096}, size_t{100'000}})
+    {
+        std::vector<GatherEntity> Entities(EntityCount);
+
+        for (size_t Index = 0; Index < EntityCount; ++Index)
+        {
+            Entities[Index].Health = static_cast<float>(Index % 1000);
+        }
+
+        const auto Column = NekiraReflect::FieldColumnView<const float>(NekiraReflect::MakeObjectSpan(Entities), VarInfo);
+
+        const std::string Size = std::string(", ") + std::to_string(EntityCount);
+
+        const double StridedLoop = NekiraBench::MeasureNs(EntityCount, [&](size_t) {
+            float Total = 0.0f;
+
+            for (const float Value : Column)
+            {
+                Total += Value;
+            }
+
+            NekiraBench::DoNotOptimize(Total);
+        });
+
+        NekiraBench::Report("FieldKernels", "strided loop sum" + Size, StridedLoop);
+
+        for (const auto InstructionSet : {BatchInstructionSet::Scalar, BatchInstructionSet::AVX2})
+        {
+            if (InstructionSet == BatchInstructionSet::AVX2 && Supported != InstructionSet)
+            {
+                continue;
+            }
+
+            NekiraReflect::SetBatchInstructionSet(InstructionSet);
+
+            const std::string Suffix = Size + ", " + GetInstructionSetName(InstructionSet);
+
+            const double Sum = NekiraBench::MeasureNs(EntityCount, [&](size_t) {
+                NekiraBench::DoNotOptimize(NekiraReflect::FieldSum(Column));
+            });
+
+            const double MinMax = NekiraBench::MeasureNs(EntityCount, [&](size_t) {
+                NekiraBench::DoNotOptimize(NekiraReflect::FieldMinMax(Column));
+            });
+
+            NekiraBench::Report("FieldKernels", "FieldSum" + Suffix, Sum);
+            NekiraBench::Report("FieldKernels", "FieldMinMax" + Suffix, MinMax);
+        }
+    }
+
+    NekiraReflect::SetBatchInstructionSet(Supported);
+}
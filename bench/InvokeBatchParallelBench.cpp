@@ -0,0 +1,110 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Batch/ObjectSpan.hpp>
+#include <NekiraReflect/DynamicReflect/Batch/WorkStealingPool.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <string>
+#include <vector>
+
+
+// InvokeBatchParallel在1到N个线程上的扩展性，以串行InvokeBatch为基准
+namespace
+{
+struct ParallelTarget
+{
+    double Value = 1.0;
+
+    // 每次调用做少量计算，使并行的收益不被内存带宽掩盖
+    double Update(double Delta)
+    {
+        for (int Step = 0; Step < 16; ++Step)
+        {
+            Value = std::sqrt(Value * Value + Delta);
+        }
+
+        return Value;
+    }
+};
+
+void RegisterParallelTarget()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<ParallelTarget>("ParallelBenchTarget");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &ParallelTarget::Value));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("Update", &ParallelTarget::Update));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+} // namespace
+
+NEKIRA_BENCH(InvokeBatchParallel)
+{
+    RegisterParallelTarget();
+
+    const auto* FuncInfo = NekiraReflect::GetNClass<ParallelTarget>()->GetFunction("Update");
+
+    constexpr size_t ObjectCount = 1'000'000;
+
+    std::vector<ParallelTarget> Objects(ObjectCount);
+    std::vector<double>         Results(ObjectCount);
+
+    const NekiraReflect::ObjectSpan Span = NekiraReflect::MakeObjectSpan(Objects);
+
+    const double Serial = NekiraBench::MeasureNs(ObjectCount, [&](size_t) {
+        FuncInfo->InvokeBatchInto(Span, std::span(Results), 0.5);
+        NekiraBench::DoNotOptimize(Results.data());
+    }, 3);
+
+    NekiraBench::Report("InvokeBatchParallel", "InvokeBatchInto (serial)", Serial);
+
+    const size_t PoolThreads = NekiraReflect::WorkStealingPool::Get().GetThreadCount();
+
+    for (size_t ThreadCount = 1;; ThreadCount = std::min(ThreadCount * 2, PoolThreads))
+    {
+        NekiraReflect::ParallelOptions Options;
+        Options.MaxThreads = ThreadCount;
+
+        const double Parallel = NekiraBench::MeasureNs(ObjectCount, [&](size_t) {
+            FuncInfo->InvokeBatchParallelInto(Span, std::span(Results), Options, 0.5);
+            NekiraBench::DoNotOptimize(Results.data());
+        }, 3);
+
+        // 逐段追加，避免GCC 12对临时字符串拼接误报-Wrestrict
+        std::string Case = "x";
+        Case += std::to_string(ThreadCount);
+        Case += " threads";
+
+        NekiraBench::Report("InvokeBatchParallel", Case, Parallel);
+        NekiraBench::ReportRatio("InvokeBatchParallel", "speedup, " + Case, Serial / Parallel, "x");
+
+        if (ThreadCount >= PoolThreads)
+        {
+            break;
+        }
+    }
+}
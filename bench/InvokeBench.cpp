@@ -0,0 +1,113 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <functional>
+#include <string>
+
+
+// 成员函数的各种调用方式：直接调用、std::function、TypedInvoker、参数帧调用与std::any调用
+namespace
+{
+struct InvokeTarget
+{
+    int Total = 0;
+
+    int Compute(float Scale, const std::string& Name)
+    {
+        Total += static_cast<int>(Scale) + static_cast<int>(Name.size());
+        return Total;
+    }
+};
+
+void RegisterInvokeTarget()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<InvokeTarget>("InvokeBenchTarget");
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("Compute", &InvokeTarget::Compute));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+} // namespace
+
+NEKIRA_BENCH(Invoke)
+{
+    RegisterInvokeTarget();
+
+    const auto* FuncInfo = NekiraReflect::GetNClass<InvokeTarget>()->GetFunction("Compute");
+
+    const auto Compute = NekiraReflect::MakeTypedInvoker<int(float, const std::string&), InvokeTarget>("Compute");
+
+    const std::function<int(InvokeTarget&, float, const std::string&)> Function = &InvokeTarget::Compute;
+
+    constexpr size_t Iterations = 1'000'000;
+
+    InvokeTarget      Object;
+    const std::string Name = "Sample";
+    float             Scale = 1.0f;
+    int               Result = 0;
+
+    const double Direct = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Scale);
+            NekiraBench::DoNotOptimize(Object.Compute(Scale, Name));
+        }
+    });
+
+    const double StdFunction = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Function(Object, Scale, Name));
+        }
+    });
+
+    const double Typed = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Compute(&Object, Scale, Name));
+        }
+    });
+
+    const double Frame = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            FuncInfo->InvokeInto(&Object, Result, Scale, Name);
+            NekiraBench::DoNotOptimize(Result);
+        }
+    });
+
+    const double Boxed = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(FuncInfo->Invoke(&Object, Scale, Name));
+        }
+    });
+
+    NekiraBench::Report("Invoke", "direct call", Direct);
+    NekiraBench::Report("Invoke", "std::function", StdFunction);
+    NekiraBench::Report("Invoke", "TypedInvoker", Typed);
+    NekiraBench::Report("Invoke", "InvokeInto (argument frame)", Frame);
+    NekiraBench::Report("Invoke", "Invoke (std::any result)", Boxed);
+}
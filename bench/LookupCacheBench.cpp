@@ -0,0 +1,156 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+
+// 线程查找缓存在不同工作集大小下的命中率与耗时，与直接查询注册表对照
+namespace
+{
+template <size_t Index>
+struct CacheBenchType
+{};
+
+struct CacheBenchRecord
+{
+    int Value = 0;
+};
+
+constexpr size_t MaxCacheTypeCount = 256;
+
+template <size_t... Indices>
+std::vector<NekiraReflect::TypeId> RegisterCacheTypes(std::index_sequence<Indices...>)
+{
+    const std::type_info* TypeInfos[] = {&typeid(CacheBenchType<Indices>)...};
+
+    auto& Arena = NekiraReflect::GetMetadataArena();
+
+    std::vector<NekiraReflect::TypeId> Ids;
+
+    // 所有类型在作用域结束时一次发布
+    NekiraReflect::ScopedRegistrationBatch Batch;
+
+    for (const std::type_info* Info : TypeInfos)
+    {
+        const std::type_index TypeIndex(*Info);
+
+        auto ClassInfo = Arena.Create<NekiraReflect::ClassTypeInfo>(
+            Arena.StoreString("CacheBenchType" + std::to_string(Ids.size())), TypeIndex);
+        ClassInfo->SetSize(sizeof(CacheBenchType<0>));
+        ClassInfo->SetTypeId(NekiraReflect::GetOrCreateTypeId(TypeIndex));
+
+        Ids.push_back(ClassInfo->GetTypeId());
+
+        NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+    }
+
+    return Ids;
+}
+
+void RegisterCacheBenchRecord()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<CacheBenchRecord>("CacheBenchRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &CacheBenchRecord::Value));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+} // namespace
+
+NEKIRA_BENCH(LookupCache)
+{
+    const auto Ids = RegisterCacheTypes(std::make_index_sequence<MaxCacheTypeCount>());
+    RegisterCacheBenchRecord();
+
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    constexpr size_t Iterations = 1'000'000;
+
+    // 工作集依次访问，超过缓存条目数或发生冲突时命中率下降
+    for (const size_t WorkingSet : {1, 16, 64, 256})
+    {
+        const std::string Case = std::to_string(WorkingSet) + " types";
+
+        NekiraReflect::ResetLookupCacheStats();
+
+        const double Cached = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+            for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+            {
+                NekiraBench::DoNotOptimize(NekiraReflect::GetNClass(Ids[Iteration % WorkingSet]));
+            }
+        });
+
+        const NekiraReflect::LookupCacheStats Stats = NekiraReflect::GetLookupCacheStats();
+
+        const double Uncached = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+            for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+            {
+                NekiraBench::DoNotOptimize(Registry.GetClassInfo(Ids[Iteration % WorkingSet]));
+            }
+        });
+
+        NekiraBench::Report("LookupCache", "GetNClass(TypeId), " + Case, Cached);
+        NekiraBench::Report("LookupCache", "Registry.GetClassInfo(TypeId), " + Case, Uncached);
+        NekiraBench::ReportRatio("LookupCache", "hit rate, " + Case,
+                                 100.0 * Stats.Hits / static_cast<double>(Stats.Hits + Stats.Misses), "%");
+    }
+
+    // 注册表每隔一段时间被修改时，Generation变化使所有条目失效
+    NekiraReflect::ResetLookupCacheStats();
+
+    const double WithChurn = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            if (Iteration % 10000 == 0)
+            {
+                RegisterCacheBenchRecord();
+            }
+
+            NekiraBench::DoNotOptimize(NekiraReflect::GetNClass(Ids[Iteration % 16]));
+        }
+    });
+
+    const NekiraReflect::LookupCacheStats ChurnStats = NekiraReflect::GetLookupCacheStats();
+
+    NekiraBench::Report("LookupCache", "GetNClass(TypeId), 16 types, replace/10k", WithChurn);
+    NekiraBench::ReportRatio("LookupCache", "hit rate, 16 types, replace/10k",
+                             100.0 * ChurnStats.Hits / static_cast<double>(ChurnStats.Hits + ChurnStats.Misses), "%");
+
+    // CachedClassInfo只比较Generation
+    NekiraReflect::CachedClassInfo<CacheBenchRecord> Handle;
+
+    const double HandleNs = NekiraBench::MeasureNs(Iterations, [&](size_t Count) {
+        for (size_t Iteration = 0; Iteration < Count; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Handle.Get());
+        }
+    });
+
+    NekiraBench::Report("LookupCache", "CachedClassInfo<T>::Get", HandleNs);
+}
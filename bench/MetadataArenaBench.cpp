@@ -0,0 +1,144 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <chrono>
+#include <string>
+#include <utility>
+
+
+// 将同一组示例类型分别注册到使用内存池与不使用内存池的模块，比较元数据的内存占用与注册耗时
+// 不使用内存池的模块单页大小为0，每个描述符与名称都单独向系统申请内存，与引入内存池之前的布局相同
+namespace
+{
+// 每个示例类型有20个成员变量与2个成员函数
+template <size_t Index>
+struct ArenaSample
+{
+    int    F00 = 0, F01 = 0, F02 = 0, F03 = 0, F04 = 0, F05 = 0, F06 = 0, F07 = 0, F08 = 0, F09 = 0;
+    float  F10 = 0, F11 = 0, F12 = 0, F13 = 0, F14 = 0;
+    double F15 = 0, F16 = 0, F17 = 0, F18 = 0, F19 = 0;
+
+    int GetTotal() const
+    {
+        return F00 + F01;
+    }
+
+    void SetTotal(int Value)
+    {
+        F00 = Value;
+    }
+};
+
+constexpr size_t SampleTypeCount = 100;
+
+template <size_t Index>
+void RegisterSample()
+{
+    using Sample = ArenaSample<Index>;
+
+    const std::string Name = std::string("ArenaSample") + std::to_string(Index);
+
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<Sample>(Name);
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F00", &Sample::F00));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F01", &Sample::F01));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F02", &Sample::F02));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F03", &Sample::F03));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F04", &Sample::F04));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F05", &Sample::F05));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F06", &Sample::F06));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F07", &Sample::F07));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F08", &Sample::F08));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F09", &Sample::F09));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F10", &Sample::F10));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F11", &Sample::F11));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F12", &Sample::F12));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F13", &Sample::F13));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F14", &Sample::F14));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F15", &Sample::F15));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F16", &Sample::F16));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F17", &Sample::F17));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F18", &Sample::F18));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F19", &Sample::F19));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("GetTotal", &Sample::GetTotal));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("SetTotal", &Sample::SetTotal));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+template <size_t... Indices>
+void RegisterSamples(std::index_sequence<Indices...>)
+{
+    (RegisterSample<Indices>(), ...);
+}
+
+// 在一个新模块中注册所有示例类型，输出模块内存池的统计与注册耗时，最后卸载模块
+// [INFO] bytes reserved不含系统分配器为每块内存附加的头部，不使用内存池时实际占用更多
+void MeasureFootprint(const char* Mode, size_t ArenaPageSize, bool bReport = true)
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    const NekiraReflect::ModuleHandle Module = Registry.CreateModule(Mode, ArenaPageSize);
+
+    NekiraReflect::MetadataArena::Statistics Stats;
+
+    const auto Start = std::chrono::steady_clock::now();
+
+    {
+        NekiraReflect::ScopedReflectionModule Scope(Module);
+        RegisterSamples(std::make_index_sequence<SampleTypeCount>());
+
+        // 作用域内的内存池即该模块的内存池
+        Stats = NekiraReflect::GetMetadataArena().GetStatistics();
+    }
+
+    const auto End = std::chrono::steady_clock::now();
+
+    Registry.UnloadModule(Module);
+
+    if (!bReport)
+    {
+        return;
+    }
+
+    const std::string Prefix = std::string(Mode) + ", ";
+
+    NekiraBench::ReportRatio("MetadataArena", Prefix + "system allocations", static_cast<double>(Stats.PageCount),
+                             "allocs");
+    NekiraBench::ReportRatio("MetadataArena", Prefix + "bytes reserved", static_cast<double>(Stats.BytesReserved),
+                             "bytes");
+    NekiraBench::ReportRatio("MetadataArena", Prefix + "bytes used", static_cast<double>(Stats.BytesUsed), "bytes");
+    NekiraBench::Report("MetadataArena", Prefix + "register per type",
+                        std::chrono::duration<double, std::nano>(End - Start).count() / SampleTypeCount);
+}
+} // namespace
+
+NEKIRA_BENCH(MetadataArena)
+{
+    // 首次注册会创建TypeId与类型操作表，先预热一次，不计入结果
+    MeasureFootprint("warm-up", NekiraReflect::MetadataArena::DefaultPageSize, false);
+
+    MeasureFootprint("with arena", NekiraReflect::MetadataArena::DefaultPageSize);
+    MeasureFootprint("without arena", 0);
+}
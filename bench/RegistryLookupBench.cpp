@@ -0,0 +1,145 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+
+// 注册表中有100、1000、10000个类型时按名称与按TypeId查询的耗时，以线性扫描名称作为对照
+namespace
+{
+// 只用于生成不同的std::type_index，不实例化任何注册函数以缩短编译时间
+template <size_t Index>
+struct LookupBenchType
+{};
+
+constexpr size_t MaxLookupTypeCount = 10000;
+
+template <size_t... Indices>
+const std::vector<const std::type_info*>& GetLookupTypeInfos(std::index_sequence<Indices...>)
+{
+    static const std::vector<const std::type_info*> TypeInfos{&typeid(LookupBenchType<Indices>)...};
+    return TypeInfos;
+}
+
+// 已注册类型的查询键
+struct LookupKeys
+{
+    std::vector<std::string>           Names;
+    std::vector<NekiraReflect::TypeId> Ids;
+};
+
+// 注册类型，直到共有TypeCount个
+void RegisterLookupTypes(LookupKeys& Keys, size_t TypeCount)
+{
+    const auto& TypeInfos = GetLookupTypeInfos(std::make_index_sequence<MaxLookupTypeCount>());
+
+    auto& Arena = NekiraReflect::GetMetadataArena();
+
+    // 所有类型在作用域结束时一次发布
+    NekiraReflect::ScopedRegistrationBatch Batch;
+
+    for (size_t Index = Keys.Names.size(); Index < TypeCount; ++Index)
+    {
+        const std::type_index TypeIndex(*TypeInfos[Index]);
+
+        std::string Name = "LookupBenchType" + std::to_string(Index);
+
+        auto ClassInfo = Arena.Create<NekiraReflect::ClassTypeInfo>(Arena.StoreString(Name), TypeIndex);
+        ClassInfo->SetSize(sizeof(LookupBenchType<0>));
+        ClassInfo->SetTypeId(NekiraReflect::GetOrCreateTypeId(TypeIndex));
+
+        Keys.Ids.push_back(ClassInfo->GetTypeId());
+        Keys.Names.push_back(std::move(Name));
+
+        NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+    }
+}
+
+void MeasureLookups(const LookupKeys& Keys)
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    const std::string Count = std::to_string(Keys.Names.size()) + " types";
+
+    // 按随机顺序查询，避免顺序访问掩盖缓存未命中
+    std::vector<size_t> Order(Keys.Names.size());
+
+    for (size_t Index = 0; Index < Order.size(); ++Index)
+    {
+        Order[Index] = Index;
+    }
+
+    std::shuffle(Order.begin(), Order.end(), std::mt19937(42));
+
+    // 首次查询发布快照
+    NekiraBench::DoNotOptimize(Registry.GetClassInfoByName(Keys.Names.front()));
+
+    const double ByName = NekiraBench::MeasureNs(1'000'000, [&](size_t Iterations) {
+        for (size_t Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Registry.GetClassInfoByName(Keys.Names[Order[Iteration % Order.size()]]));
+        }
+    });
+
+    const double ById = NekiraBench::MeasureNs(1'000'000, [&](size_t Iterations) {
+        for (size_t Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Registry.GetClassInfo(Keys.Ids[Order[Iteration % Order.size()]]));
+        }
+    });
+
+    // 对照：逐个比较名称的线性扫描
+    const double LinearScan = NekiraBench::MeasureNs(10'000, [&](size_t Iterations) {
+        for (size_t Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const std::string& Name = Keys.Names[Order[Iteration % Order.size()]];
+            NekiraBench::DoNotOptimize(std::find(Keys.Names.begin(), Keys.Names.end(), Name));
+        }
+    });
+
+    NekiraBench::Report("RegistryLookup", "GetClassInfoByName, " + Count, ByName);
+    NekiraBench::Report("RegistryLookup", "GetClassInfo(TypeId), " + Count, ById);
+    NekiraBench::Report("RegistryLookup", "linear name scan, " + Count, LinearScan);
+}
+} // namespace
+
+NEKIRA_BENCH(RegistryLookup)
+{
+    LookupKeys Keys;
+
+    for (const size_t TypeCount : {100, 1000, 10000})
+    {
+        RegisterLookupTypes(Keys, TypeCount);
+        MeasureLookups(Keys);
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// 多个读者线程同时按类型与按名称查询注册表，查询应随线程数线性扩展
+namespace
+{
+struct ReadBenchRecord
+{
+    int         Value = 0;
+    std::string Name;
+};
+
+void RegisterReadBenchRecord()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<ReadBenchRecord>("ReadBenchRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &ReadBenchRecord::Value));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &ReadBenchRecord::Name));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+// 在ThreadCount个线程上同时执行Lookup，返回所有线程合计的每次查询纳秒数
+template <typename LookupFunc>
+double MeasureConcurrentReads(size_t ThreadCount, size_t Iterations, LookupFunc Lookup)
+{
+    return NekiraBench::MeasureNs(Iterations * ThreadCount, [&](size_t) {
+        std::atomic<bool>        bStart{false};
+        std::vector<std::thread> Threads;
+
+        for (size_t Index = 0; Index < ThreadCount; ++Index)
+        {
+            Threads.emplace_back([&] {
+                while (!bStart.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (size_t Iteration = 0; Iteration < Iterations; ++Iteration)
+                {
+                    NekiraBench::DoNotOptimize(Lookup());
+                }
+            });
+        }
+
+        bStart.store(true, std::memory_order_release);
+
+        for (auto& Thread : Threads)
+        {
+            Thread.join();
+        }
+    });
+}
+} // namespace
+
+NEKIRA_BENCH(RegistryRead)
+{
+    RegisterReadBenchRecord();
+
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    // 首次查询发布快照
+    NekiraBench::DoNotOptimize(Registry.GetClassInfo<ReadBenchRecord>());
+
+    constexpr size_t Iterations = 1'000'000;
+
+    const size_t MaxThreads = std::max<size_t>(4, std::thread::hardware_concurrency());
+
+    for (size_t ThreadCount = 1; ThreadCount <= MaxThreads; ThreadCount *= 2)
+    {
+        const std::string Suffix = " x" + std::to_string(ThreadCount) + " threads";
+
+        const double ByType = MeasureConcurrentReads(ThreadCount, Iterations, [&] {
+            return Registry.GetClassInfo<ReadBenchRecord>();
+        });
+
+        const double ByName = MeasureConcurrentReads(ThreadCount, Iterations, [&] {
+            return Registry.GetClassInfoByName("ReadBenchRecord");
+        });
+
+        NekiraBench::Report("RegistryRead", "GetClassInfo<T>" + Suffix, ByType);
+        NekiraBench::Report("RegistryRead", "GetClassInfoByName" + Suffix, ByName);
+    }
+}
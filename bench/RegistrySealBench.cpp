@@ -0,0 +1,143 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <BenchCommon.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+
+// 同一组类型在封存前后按std::type_index与名称查询的耗时
+// [INFO] 封存不可撤销，因此该基准在其他基准之后运行
+namespace
+{
+// 只用于生成不同的std::type_index
+template <size_t Index>
+struct SealBenchType
+{};
+
+constexpr size_t SealTypeCount = 1000;
+
+template <size_t... Indices>
+std::vector<std::type_index> GetSealTypeIndices(std::index_sequence<Indices...>)
+{
+    return {std::type_index(typeid(SealBenchType<Indices>))...};
+}
+
+// 查询所用的键
+struct SealKeys
+{
+    std::vector<std::type_index> TypeIndices;
+    std::vector<std::string>     Names;
+    std::vector<size_t>          Order;
+};
+
+SealKeys RegisterSealTypes()
+{
+    SealKeys Keys;
+    Keys.TypeIndices = GetSealTypeIndices(std::make_index_sequence<SealTypeCount>());
+
+    auto& Arena = NekiraReflect::GetMetadataArena();
+
+    // 所有类型在作用域结束时一次发布
+    NekiraReflect::ScopedRegistrationBatch Batch;
+
+    for (size_t Index = 0; Index < Keys.TypeIndices.size(); ++Index)
+    {
+        const std::type_index TypeIndex = Keys.TypeIndices[Index];
+
+        std::string Name = "SealBenchType" + std::to_string(Index);
+
+        auto ClassInfo = Arena.Create<NekiraReflect::ClassTypeInfo>(Arena.StoreString(Name), TypeIndex);
+        ClassInfo->SetSize(sizeof(SealBenchType<0>));
+        ClassInfo->SetTypeId(NekiraReflect::GetOrCreateTypeId(TypeIndex));
+
+        Keys.Names.push_back(std::move(Name));
+        Keys.Order.push_back(Index);
+
+        NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+    }
+
+    // 按随机顺序查询，避免顺序访问掩盖缓存未命中
+    std::shuffle(Keys.Order.begin(), Keys.Order.end(), std::mt19937(42));
+
+    return Keys;
+}
+
+struct SealTimings
+{
+    double ByType = 0.0;
+    double ByName = 0.0;
+};
+
+SealTimings MeasureSealLookups(const SealKeys& Keys)
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    // 首次查询发布快照
+    NekiraBench::DoNotOptimize(Registry.GetClassInfo(Keys.TypeIndices.front()));
+
+    SealTimings Result;
+
+    Result.ByType = NekiraBench::MeasureNs(1'000'000, [&](size_t Iterations) {
+        for (size_t Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Registry.GetClassInfo(Keys.TypeIndices[Keys.Order[Iteration % SealTypeCount]]));
+        }
+    });
+
+    Result.ByName = NekiraBench::MeasureNs(1'000'000, [&](size_t Iterations) {
+        for (size_t Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            NekiraBench::DoNotOptimize(Registry.GetClassInfoByName(Keys.Names[Keys.Order[Iteration % SealTypeCount]]));
+        }
+    });
+
+    return Result;
+}
+} // namespace
+
+NEKIRA_BENCH_LAST(RegistrySeal)
+{
+    const SealKeys Keys = RegisterSealTypes();
+
+    const SealTimings Unsealed = MeasureSealLookups(Keys);
+
+    NekiraReflect::ReflectionRegistry::Get().Seal();
+
+    const SealTimings Sealed = MeasureSealLookups(Keys);
+
+    NekiraBench::Report("RegistrySeal", "GetClassInfo(type_index), unsealed", Unsealed.ByType);
+    NekiraBench::Report("RegistrySeal", "GetClassInfo(type_index), sealed", Sealed.ByType);
+    NekiraBench::ReportRatio("RegistrySeal", "type_index speedup", Unsealed.ByType / Sealed.ByType, "x");
+    NekiraBench::Report("RegistrySeal", "GetClassInfoByName, unsealed", Unsealed.ByName);
+    NekiraBench::Report("RegistrySeal", "GetClassInfoByName, sealed", Sealed.ByName);
+    NekiraBench::ReportRatio("RegistrySeal", "name speedup", Unsealed.ByName / Sealed.ByName, "x");
+}
@@ -25,6 +25,12 @@
 #pragma once
 
 #include <NekiraReflect/DynamicReflect/Utility/Utilities.hpp>
+#include <type_traits>
+#include <utility>
+
+#ifdef NEKIRA_REFLECT_PROFILE_REGISTRATION
+#include <NekiraReflect/DynamicReflect/Registry/RegistrationProfiler.hpp>
+#endif
 
 namespace NekiraReflect
 {
@@ -41,10 +47,22 @@ public:
 } // namespace NekiraReflect
 
 
+// ========================================= 注册耗时统计 ========================================= //
+// 统计RegisterReflection()的耗时与创建的元数据，仅在定义NEKIRA_REFLECT_PROFILE_REGISTRATION时生效
+#ifndef NEKIRA_REFLECT_PROFILE_SCOPE
+#ifdef NEKIRA_REFLECT_PROFILE_REGISTRATION
+#define NEKIRA_REFLECT_PROFILE_SCOPE(QualifiedName)                                                                    \
+    NekiraReflect::RegistrationProfileScope profileScope(#QualifiedName);
+#else
+#define NEKIRA_REFLECT_PROFILE_SCOPE(QualifiedName)
+#endif
+#endif
+
+
 // ========================================= 类的反射访问器 ========================================= //
-// 定义类的反射访问器特化(无命名空间)
-#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL
-#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL(ClassName)                                                                  \
+// 开始定义类的反射访问器特化(无命名空间)，之后可以声明生成的setter，以NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END()结束
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN(ClassName)                                                            \
     class ClassName;                                                                                                   \
     namespace NekiraReflect                                                                                            \
     {                                                                                                                  \
@@ -53,14 +71,12 @@ public:
     {                                                                                                                  \
     public:                                                                                                            \
         using ClassType = ClassName;                                                                                   \
-        static void RegisterReflection();                                                                              \
-    };                                                                                                                 \
-    } // namespace NekiraReflect
+        static void RegisterReflection();
 #endif
 
-// 定义类的反射访问器特化(有命名空间)
-#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_NS
-#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_NS(NameSpace, ClassName)                                                    \
+// 开始定义类的反射访问器特化(有命名空间)
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN_NS
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN_NS(NameSpace, ClassName)                                              \
     namespace NameSpace                                                                                                \
     {                                                                                                                  \
     class ClassName;                                                                                                   \
@@ -72,11 +88,47 @@ public:
     {                                                                                                                  \
     public:                                                                                                            \
         using ClassType = NameSpace::ClassName;                                                                        \
-        static void RegisterReflection();                                                                              \
+        static void RegisterReflection();
+#endif
+
+// 生成的setter：写入成员变量，所在类启用脏成员追踪时同时标记该成员
+// [INFO] 声明时类尚未定义，因此以模板延迟到调用时再访问成员；成员的脏标记下标在首次调用时解析并缓存
+// @example:
+// NekiraReflect::ReflectionAccessor<Player>::SetHealth(Object, 10);
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_SETTER
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_SETTER(VarName)                                                                  \
+    template <typename ObjectType, typename ValueType>                                                                 \
+    static void Set##VarName(ObjectType& object, ValueType&& value)                                                    \
+    {                                                                                                                  \
+        static_assert(std::is_same_v<ObjectType, ClassType>, "Set" #VarName " requires an object of its class");      \
+        using VarType = std::remove_cvref_t<decltype(object.VarName)>;                                                 \
+        static const FieldHandle<VarType> field(GetNClass<ObjectType>(), #VarName);                                    \
+        object.VarName = std::forward<ValueType>(value);                                                               \
+        field.MarkDirty(&object);                                                                                      \
+    }
+#endif
+
+// 结束类的反射访问器特化
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END()                                                                       \
     };                                                                                                                 \
     } // namespace NekiraReflect
 #endif
 
+// 定义类的反射访问器特化(无命名空间)
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL(ClassName)                                                                  \
+    NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN(ClassName)                                                                \
+    NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END()
+#endif
+
+// 定义类的反射访问器特化(有命名空间)
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_NS
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_NS(NameSpace, ClassName)                                                    \
+    NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN_NS(NameSpace, ClassName)                                                  \
+    NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END()
+#endif
+
 // 定义类反射访问器RegisterReflection()实现
 #ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN
 #define NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN(QualifiedName)                                                             \
@@ -84,6 +136,7 @@ public:
     {                                                                                                                  \
     void ReflectionAccessor<QualifiedName>::RegisterReflection()                                                       \
     {                                                                                                                  \
+        NEKIRA_REFLECT_PROFILE_SCOPE(QualifiedName)                                                                    \
         auto classInfo = MakeClassTypeInfo<QualifiedName>(#QualifiedName);
 #endif
 
@@ -93,6 +146,17 @@ public:
     classInfo->AddVariable(MakeMemberVarInfo(#VarName, &ClassType::VarName));
 #endif
 
+// 通过类反射访问器注册公有基类(可变参数以支持带逗号的模板基类)
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_BASE
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_BASE(...)                                                                        \
+    classInfo->AddBaseClass(MakeBaseClassInfo<ClassType, __VA_ARGS__>());
+#endif
+
+// 通过类反射访问器启用脏成员追踪，VarName为类中DirtyFieldSet类型的成员
+#ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_DIRTY
+#define NEKIRA_REFLECT_CLASS_ACCESSOR_DIRTY(VarName) classInfo->EnableDirtyTracking(&ClassType::VarName);
+#endif
+
 // 通过类反射访问器注册成员函数
 #ifndef NEKIRA_REFLECT_CLASS_ACCESSOR_FUNC
 #define NEKIRA_REFLECT_CLASS_ACCESSOR_FUNC(FuncName)                                                                   \
@@ -108,7 +172,11 @@ public:
 #endif
 
 // 自动注册类的反射信息(无命名空间)
+// [INFO] 定义NEKIRA_REFLECT_LAZY_REGISTRATION时改为延迟注册
 #ifndef NEKIRA_REFLECT_CLASS_REGISTER_AUTO
+#ifdef NEKIRA_REFLECT_LAZY_REGISTRATION
+#define NEKIRA_REFLECT_CLASS_REGISTER_AUTO(ClassName) NEKIRA_REFLECT_CLASS_REGISTER_LAZY(ClassName)
+#else
 #define NEKIRA_REFLECT_CLASS_REGISTER_AUTO(ClassName)                                                                  \
     struct ClassName##_ClassAutoRegister                                                                               \
     {                                                                                                                  \
@@ -119,9 +187,14 @@ public:
     };                                                                                                                 \
     static ClassName##_ClassAutoRegister ClassName##_ClassAutoRegister_Inst;
 #endif
+#endif
 
 // 自动注册类的反射信息(有命名空间)
 #ifndef NEKIRA_REFLECT_CLASS_REGISTER_AUTO_NS
+#ifdef NEKIRA_REFLECT_LAZY_REGISTRATION
+#define NEKIRA_REFLECT_CLASS_REGISTER_AUTO_NS(NameSpace, ClassName)                                                    \
+    NEKIRA_REFLECT_CLASS_REGISTER_LAZY_NS(NameSpace, ClassName)
+#else
 #define NEKIRA_REFLECT_CLASS_REGISTER_AUTO_NS(NameSpace, ClassName)                                                    \
     namespace NameSpace                                                                                                \
     {                                                                                                                  \
@@ -135,6 +208,39 @@ public:
     static ClassName##_ClassAutoRegister ClassName##_ClassAutoRegister_Inst;                                           \
     } // namespace NameSpace
 #endif
+#endif
+
+// 延迟注册类的反射信息(无命名空间)，静态初始化时只记录注册函数，首次查询该类时才构建反射信息
+#ifndef NEKIRA_REFLECT_CLASS_REGISTER_LAZY
+#define NEKIRA_REFLECT_CLASS_REGISTER_LAZY(ClassName)                                                                  \
+    struct ClassName##_ClassLazyRegister                                                                               \
+    {                                                                                                                  \
+        ClassName##_ClassLazyRegister()                                                                                \
+        {                                                                                                              \
+            NekiraReflect::RegisterLazyClassInfo(NekiraReflect::GetTypeIndex<ClassName>(), #ClassName,                 \
+                                                 &NekiraReflect::ReflectionAccessor<ClassName>::RegisterReflection);   \
+        }                                                                                                              \
+    };                                                                                                                 \
+    static ClassName##_ClassLazyRegister ClassName##_ClassLazyRegister_Inst;
+#endif
+
+// 延迟注册类的反射信息(有命名空间)
+#ifndef NEKIRA_REFLECT_CLASS_REGISTER_LAZY_NS
+#define NEKIRA_REFLECT_CLASS_REGISTER_LAZY_NS(NameSpace, ClassName)                                                    \
+    namespace NameSpace                                                                                                \
+    {                                                                                                                  \
+    struct ClassName##_ClassLazyRegister                                                                               \
+    {                                                                                                                  \
+        ClassName##_ClassLazyRegister()                                                                                \
+        {                                                                                                              \
+            NekiraReflect::RegisterLazyClassInfo(                                                                      \
+                NekiraReflect::GetTypeIndex<NameSpace::ClassName>(), #NameSpace "::" #ClassName,                       \
+                &NekiraReflect::ReflectionAccessor<NameSpace::ClassName>::RegisterReflection);                         \
+        }                                                                                                              \
+    };                                                                                                                 \
+    static ClassName##_ClassLazyRegister ClassName##_ClassLazyRegister_Inst;                                           \
+    } // namespace NameSpace
+#endif
 
 // ============================================ 枚举的反射访问器 ============================================ //
 // 定义枚举的反射访问器特化(无命名空间)
@@ -180,6 +286,7 @@ public:
     {                                                                                                                  \
     void ReflectionAccessor<QualifiedName>::RegisterReflection()                                                       \
     {                                                                                                                  \
+        NEKIRA_REFLECT_PROFILE_SCOPE(QualifiedName)                                                                    \
         auto enumInfo = MakeEnumTypeInfo<QualifiedName>(#QualifiedName);
 #endif
 
@@ -198,7 +305,11 @@ public:
 #endif
 
 // 自动注册枚举的反射信息(无命名空间)
+// [INFO] 定义NEKIRA_REFLECT_LAZY_REGISTRATION时改为延迟注册
 #ifndef NEKIRA_REFLECT_ENUM_REGISTER_AUTO
+#ifdef NEKIRA_REFLECT_LAZY_REGISTRATION
+#define NEKIRA_REFLECT_ENUM_REGISTER_AUTO(EnumName) NEKIRA_REFLECT_ENUM_REGISTER_LAZY(EnumName)
+#else
 #define NEKIRA_REFLECT_ENUM_REGISTER_AUTO(EnumName)                                                                    \
     struct EnumName##_EnumAutoRegister                                                                                 \
     {                                                                                                                  \
@@ -209,9 +320,14 @@ public:
     };                                                                                                                 \
     static EnumName##_EnumAutoRegister EnumName##_EnumAutoRegister_Inst;
 #endif
+#endif
 
 // 自动注册枚举的反射信息(有命名空间)
 #ifndef NEKIRA_REFLECT_ENUM_REGISTER_AUTO_NS
+#ifdef NEKIRA_REFLECT_LAZY_REGISTRATION
+#define NEKIRA_REFLECT_ENUM_REGISTER_AUTO_NS(NameSpace, EnumName)                                                      \
+    NEKIRA_REFLECT_ENUM_REGISTER_LAZY_NS(NameSpace, EnumName)
+#else
 #define NEKIRA_REFLECT_ENUM_REGISTER_AUTO_NS(NameSpace, EnumName)                                                      \
     namespace NameSpace                                                                                                \
     {                                                                                                                  \
@@ -224,4 +340,37 @@ public:
     };                                                                                                                 \
     static EnumName##_EnumAutoRegister EnumName##_EnumAutoRegister_Inst;                                               \
     } // namespace NameSpace
+#endif
+#endif
+
+// 延迟注册枚举的反射信息(无命名空间)，静态初始化时只记录注册函数，首次查询该枚举时才构建反射信息
+#ifndef NEKIRA_REFLECT_ENUM_REGISTER_LAZY
+#define NEKIRA_REFLECT_ENUM_REGISTER_LAZY(EnumName)                                                                    \
+    struct EnumName##_EnumLazyRegister                                                                                 \
+    {                                                                                                                  \
+        EnumName##_EnumLazyRegister()                                                                                  \
+        {                                                                                                              \
+            NekiraReflect::RegisterLazyEnumInfo(NekiraReflect::GetTypeIndex<EnumName>(), #EnumName,                    \
+                                                &NekiraReflect::ReflectionAccessor<EnumName>::RegisterReflection);     \
+        }                                                                                                              \
+    };                                                                                                                 \
+    static EnumName##_EnumLazyRegister EnumName##_EnumLazyRegister_Inst;
+#endif
+
+// 延迟注册枚举的反射信息(有命名空间)
+#ifndef NEKIRA_REFLECT_ENUM_REGISTER_LAZY_NS
+#define NEKIRA_REFLECT_ENUM_REGISTER_LAZY_NS(NameSpace, EnumName)                                                      \
+    namespace NameSpace                                                                                                \
+    {                                                                                                                  \
+    struct EnumName##_EnumLazyRegister                                                                                 \
+    {                                                                                                                  \
+        EnumName##_EnumLazyRegister()                                                                                  \
+        {                                                                                                              \
+            NekiraReflect::RegisterLazyEnumInfo(                                                                       \
+                NekiraReflect::GetTypeIndex<NameSpace::EnumName>(), #NameSpace "::" #EnumName,                         \
+                &NekiraReflect::ReflectionAccessor<NameSpace::EnumName>::RegisterReflection);                          \
+        }                                                                                                              \
+    };                                                                                                                 \
+    static EnumName##_EnumLazyRegister EnumName##_EnumLazyRegister_Inst;                                               \
+    } // namespace NameSpace
 #endif
\ No newline at end of file
@@ -0,0 +1,250 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/Batch/ObjectSpan.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/CoreType.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/FieldHandle.hpp>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+// ======================================= 成员变量列视图 ======================================= //
+namespace NekiraReflect
+{
+
+// 对象数组中某个成员变量的列视图，第i个元素位于 Data + i * Stride + Offset，访问时不再查找成员
+// [INFO] VarType可以带const，此时视图只读。类型不匹配或成员无效时视图为空
+// @example:
+// auto Column = FieldColumnView<float>(MakeObjectSpan(Entities), ClassInfo->GetVariable("Health"));
+// float Total = std::accumulate(Column.begin(), Column.end(), 0.0f);
+template <typename VarType>
+class FieldColumnView final
+{
+    using BytePointer = std::conditional_t<std::is_const_v<VarType>, const char*, char*>;
+
+public:
+    class Iterator final
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cv_t<VarType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = VarType*;
+        using reference = VarType&;
+
+        Iterator() = default;
+
+        Iterator(BytePointer address, difference_type stride) : Address(address), Stride(stride)
+        {}
+
+        reference operator*() const
+        {
+            return *reinterpret_cast<pointer>(Address);
+        }
+
+        pointer operator->() const
+        {
+            return reinterpret_cast<pointer>(Address);
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return *reinterpret_cast<pointer>(Address + n * Stride);
+        }
+
+        Iterator& operator++()
+        {
+            Address += Stride;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator Result = *this;
+            Address += Stride;
+            return Result;
+        }
+
+        Iterator& operator--()
+        {
+            Address -= Stride;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator Result = *this;
+            Address -= Stride;
+            return Result;
+        }
+
+        Iterator& operator+=(difference_type n)
+        {
+            Address += n * Stride;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n)
+        {
+            Address -= n * Stride;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it)
+        {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.Stride != 0 ? (lhs.Address - rhs.Address) / lhs.Stride : 0;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.Address == rhs.Address;
+        }
+
+        friend auto operator<=>(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.Address <=> rhs.Address;
+        }
+
+    private:
+        BytePointer     Address = nullptr;
+        difference_type Stride = 0;
+    };
+
+    FieldColumnView() = default;
+
+    FieldColumnView(const ObjectSpan& objects, const MemberVarInfo* varInfo)
+    {
+        if (varInfo == nullptr)
+        {
+            return;
+        }
+
+        // TypeId与std::type_index一致，忽略顶层的const/volatile
+        if (varInfo->GetTypeId() != TypeIdOf<VarType>())
+        {
+            std::cerr << "[NekiraReflect] FieldColumnView type mismatch for member " << varInfo->GetName() << ".\n";
+            return;
+        }
+
+        Bind(objects, varInfo->GetOffset());
+    }
+
+    FieldColumnView(const ObjectSpan& objects, const FieldHandle<std::remove_cv_t<VarType>>& field)
+    {
+        if (field)
+        {
+            Bind(objects, field.GetOffset());
+        }
+    }
+
+    inline size_t size() const
+    {
+        return Count;
+    }
+
+    inline bool empty() const
+    {
+        return Count == 0;
+    }
+
+    inline VarType& operator[](size_t index) const
+    {
+        return *reinterpret_cast<VarType*>(Data + index * Stride);
+    }
+
+    inline Iterator begin() const
+    {
+        return Iterator(Data, static_cast<std::ptrdiff_t>(Stride));
+    }
+
+    inline Iterator end() const
+    {
+        return Iterator(Data + Count * Stride, static_cast<std::ptrdiff_t>(Stride));
+    }
+
+    // 第一个元素的地址(已加上成员偏移)
+    inline BytePointer GetData() const
+    {
+        return Data;
+    }
+
+    // 相邻元素之间的字节数
+    inline size_t GetStride() const
+    {
+        return Stride;
+    }
+
+private:
+    void Bind(const ObjectSpan& objects, size_t offset)
+    {
+        if (objects.Data == nullptr)
+        {
+            return;
+        }
+
+        Data = static_cast<BytePointer>(objects.Data) + offset;
+        Stride = objects.Stride;
+        Count = objects.Count;
+    }
+
+private:
+    BytePointer Data = nullptr;
+    size_t      Stride = 0;
+    size_t      Count = 0;
+};
+
+// Make a per-object argument column for batch invocation from a member variable column
+template <typename VarType>
+ArgumentColumn MakeArgumentColumn(const FieldColumnView<VarType>& Column)
+{
+    ArgumentColumn Result;
+    Result.Data = const_cast<std::remove_const_t<VarType>*>(reinterpret_cast<VarType*>(Column.GetData()));
+    Result.Stride = Column.GetStride();
+    Result.Count = Column.size();
+    Result.Id = TypeIdOf<VarType>();
+    Result.bConst = std::is_const_v<VarType>;
+    return Result;
+}
+
+} // namespace NekiraReflect
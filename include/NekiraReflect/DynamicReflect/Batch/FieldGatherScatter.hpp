@@ -0,0 +1,101 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/Batch/FieldColumnView.hpp>
+#include <cstdint>
+#include <type_traits>
+
+
+// ======================================= 成员变量的批量收集与分发 ======================================= //
+namespace NekiraReflect
+{
+
+// 批量运算使用的指令集
+enum class BatchInstructionSet
+{
+    Scalar,
+    AVX2
+};
+
+// 获取批量运算当前使用的指令集(默认为CPU支持的最高指令集)
+BatchInstructionSet GetBatchInstructionSet();
+
+// 限制批量运算可使用的指令集(用于测试与性能比较)，不会超过CPU支持的指令集
+void SetBatchInstructionSet(BatchInstructionSet InstructionSet);
+
+// 将每个对象的成员变量依次复制到连续的Dense数组中(Dense须至少有Objects.Count个元素)
+// [INFO] 可按字节复制的成员直接复制字节，4/8字节的成员在支持AVX2时使用硬件gather；
+// 其余成员通过复制赋值，此时Dense须是已构造的对象数组
+void GatherField(const ObjectSpan& Objects, const MemberVarInfo* VarInfo, void* Dense);
+
+// 将连续的Dense数组依次复制到每个对象的成员变量中
+// [INFO] AVX2没有scatter指令，逐元素存储与标量实现相当，因此分发总是使用标量实现
+void ScatterField(const ObjectSpan& Objects, const MemberVarInfo* VarInfo, const void* Dense);
+
+// 将Src中每个对象的成员变量复制到Dst中对应的对象，数量取两者中较小者
+void CopyField(const ObjectSpan& Dst, const ObjectSpan& Src, const MemberVarInfo* VarInfo);
+
+// 将Count个相隔Stride字节、大小为Size字节的元素按字节收集到连续的Dense数组中
+// [INFO] 与GatherField使用同一实现，4/8字节的元素在支持AVX2时使用硬件gather
+void GatherStrided(const void* Src, size_t Stride, size_t Count, size_t Size, void* Dense);
+
+
+// ===================================== 连续数组的归约 ===================================== //
+// 支持AVX2时使用SIMD指令，否则使用按4路展开的标量循环，由GetBatchInstructionSet决定
+// [INFO] 浮点数求和的结果可能与顺序累加略有差异
+
+// Sum of a dense array, integers are widened to 64 bits
+int64_t  DenseSum(const int32_t* Values, size_t Count);
+uint64_t DenseSum(const uint32_t* Values, size_t Count);
+int64_t  DenseSum(const int64_t* Values, size_t Count);
+uint64_t DenseSum(const uint64_t* Values, size_t Count);
+float    DenseSum(const float* Values, size_t Count);
+double   DenseSum(const double* Values, size_t Count);
+
+// Fold a dense array into Min and Max, which hold the initial values
+// [INFO] 与std::minmax_element相同只使用operator<，NaN不会替换Min与Max
+void DenseMinMax(const int32_t* Values, size_t Count, int32_t& Min, int32_t& Max);
+void DenseMinMax(const uint32_t* Values, size_t Count, uint32_t& Min, uint32_t& Max);
+void DenseMinMax(const int64_t* Values, size_t Count, int64_t& Min, int64_t& Max);
+void DenseMinMax(const uint64_t* Values, size_t Count, uint64_t& Min, uint64_t& Max);
+void DenseMinMax(const float* Values, size_t Count, float& Min, float& Max);
+void DenseMinMax(const double* Values, size_t Count, double& Min, double& Max);
+
+// Count the elements of a dense array equal to Value
+size_t DenseCount(const int32_t* Values, size_t Count, int32_t Value);
+size_t DenseCount(const uint32_t* Values, size_t Count, uint32_t Value);
+size_t DenseCount(const int64_t* Values, size_t Count, int64_t Value);
+size_t DenseCount(const uint64_t* Values, size_t Count, uint64_t Value);
+size_t DenseCount(const float* Values, size_t Count, float Value);
+size_t DenseCount(const double* Values, size_t Count, double Value);
+
+// 具有上述连续数组归约的类型
+template <typename ValueType>
+inline constexpr bool bHasDenseKernel =
+    std::is_same_v<ValueType, int32_t> || std::is_same_v<ValueType, uint32_t> || std::is_same_v<ValueType, int64_t> ||
+    std::is_same_v<ValueType, uint64_t> || std::is_same_v<ValueType, float> || std::is_same_v<ValueType, double>;
+
+} // namespace NekiraReflect
@@ -0,0 +1,259 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/Batch/FieldColumnView.hpp>
+#include <NekiraReflect/DynamicReflect/Batch/FieldGatherScatter.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+
+// ===================================== 成员变量列的运算 ===================================== //
+// [INFO] 列中的元素按步长分散存放，无法直接使用连续的SIMD加载。32/64位整数与浮点数的列先分块收集到栈上的连续缓冲区
+// (支持AVX2时使用硬件gather)，再用连续数组的SIMD归约处理(见FieldGatherScatter.hpp)；列本身连续时直接归约。
+// 其余类型使用按4路展开的标量循环。两种实现都将元素分到多个独立的部分结果中，浮点数求和的结果可能与顺序累加略有差异
+namespace NekiraReflect
+{
+
+// 收集列时使用的栈上缓冲区大小(字节)
+inline constexpr size_t FieldKernelBlockBytes = 4096;
+
+// 将列从First开始分块收集为连续数组，依次调用Func(const ValueType* Values, size_t Count)
+template <typename VarType, typename FuncType>
+void FieldKernel_ForEachBlock(const FieldColumnView<VarType>& Column, size_t First, FuncType&& Func)
+{
+    using ValueType = std::remove_cv_t<VarType>;
+
+    const size_t Count = Column.size();
+    const size_t Stride = Column.GetStride();
+
+    if (First >= Count)
+    {
+        return;
+    }
+
+    if (Stride == sizeof(ValueType))
+    {
+        Func(reinterpret_cast<const ValueType*>(Column.GetData()) + First, Count - First);
+        return;
+    }
+
+    constexpr size_t BlockCount = FieldKernelBlockBytes / sizeof(ValueType);
+
+    alignas(32) ValueType Block[BlockCount];
+
+    for (size_t Index = First; Index < Count; Index += BlockCount)
+    {
+        const size_t Chunk = std::min(BlockCount, Count - Index);
+
+        GatherStrided(Column.GetData() + Index * Stride, Stride, Chunk, sizeof(ValueType), Block);
+        Func(static_cast<const ValueType*>(Block), Chunk);
+    }
+}
+
+// 求和使用的累加类型：整数扩展为64位，浮点数保持原类型
+template <typename ValueType>
+using FieldSumType = std::conditional_t<std::is_floating_point_v<ValueType>, ValueType,
+                                        std::conditional_t<std::is_signed_v<ValueType>, int64_t, uint64_t>>;
+
+// Sum of an arithmetic column
+template <typename VarType>
+FieldSumType<std::remove_cv_t<VarType>> FieldSum(const FieldColumnView<VarType>& Column)
+{
+    using ValueType = std::remove_cv_t<VarType>;
+    using SumType = FieldSumType<ValueType>;
+
+    static_assert(std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>,
+                  "FieldSum requires an arithmetic field type");
+
+    if constexpr (bHasDenseKernel<ValueType>)
+    {
+        SumType Result = 0;
+
+        FieldKernel_ForEachBlock(Column, 0, [&Result](const ValueType* Values, size_t Count) {
+            Result += static_cast<SumType>(DenseSum(Values, Count));
+        });
+
+        return Result;
+    }
+
+    const size_t Count = Column.size();
+
+    SumType Partials[4] = {};
+    size_t  Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        Partials[0] += static_cast<SumType>(Column[Index]);
+        Partials[1] += static_cast<SumType>(Column[Index + 1]);
+        Partials[2] += static_cast<SumType>(Column[Index + 2]);
+        Partials[3] += static_cast<SumType>(Column[Index + 3]);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Partials[0] += static_cast<SumType>(Column[Index]);
+    }
+
+    return (Partials[0] + Partials[1]) + (Partials[2] + Partials[3]);
+}
+
+// Minimum and maximum of an arithmetic column, std::nullopt for an empty column
+// [INFO] 与std::minmax_element相同只使用operator<，NaN不会成为结果(除非第一个元素为NaN)
+template <typename VarType>
+std::optional<std::pair<std::remove_cv_t<VarType>, std::remove_cv_t<VarType>>>
+FieldMinMax(const FieldColumnView<VarType>& Column)
+{
+    using ValueType = std::remove_cv_t<VarType>;
+
+    static_assert(std::is_arithmetic_v<ValueType>, "FieldMinMax requires an arithmetic field type");
+
+    const size_t Count = Column.size();
+
+    if (Count == 0)
+    {
+        return std::nullopt;
+    }
+
+    const ValueType First = Column[0];
+
+    if constexpr (bHasDenseKernel<ValueType>)
+    {
+        ValueType Min = First;
+        ValueType Max = First;
+
+        FieldKernel_ForEachBlock(Column, 1, [&Min, &Max](const ValueType* Values, size_t Count) {
+            DenseMinMax(Values, Count, Min, Max);
+        });
+
+        return std::make_pair(Min, Max);
+    }
+
+    ValueType Mins[4] = {First, First, First, First};
+    ValueType Maxs[4] = {First, First, First, First};
+    size_t    Index = 1;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        const ValueType Value0 = Column[Index];
+        const ValueType Value1 = Column[Index + 1];
+        const ValueType Value2 = Column[Index + 2];
+        const ValueType Value3 = Column[Index + 3];
+
+        Mins[0] = Value0 < Mins[0] ? Value0 : Mins[0];
+        Mins[1] = Value1 < Mins[1] ? Value1 : Mins[1];
+        Mins[2] = Value2 < Mins[2] ? Value2 : Mins[2];
+        Mins[3] = Value3 < Mins[3] ? Value3 : Mins[3];
+
+        Maxs[0] = Maxs[0] < Value0 ? Value0 : Maxs[0];
+        Maxs[1] = Maxs[1] < Value1 ? Value1 : Maxs[1];
+        Maxs[2] = Maxs[2] < Value2 ? Value2 : Maxs[2];
+        Maxs[3] = Maxs[3] < Value3 ? Value3 : Maxs[3];
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        const ValueType Value = Column[Index];
+        Mins[0] = Value < Mins[0] ? Value : Mins[0];
+        Maxs[0] = Maxs[0] < Value ? Value : Maxs[0];
+    }
+
+    for (size_t Partial = 1; Partial < 4; ++Partial)
+    {
+        Mins[0] = Mins[Partial] < Mins[0] ? Mins[Partial] : Mins[0];
+        Maxs[0] = Maxs[0] < Maxs[Partial] ? Maxs[Partial] : Maxs[0];
+    }
+
+    return std::make_pair(Mins[0], Maxs[0]);
+}
+
+// Count the elements of a column for which Predicate returns true
+// [INFO] 算术类型的列先收集为连续数组，内联的谓词可由编译器向量化
+template <typename VarType, typename PredicateType>
+size_t FieldCountIf(const FieldColumnView<VarType>& Column, PredicateType&& Predicate)
+{
+    using ValueType = std::remove_cv_t<VarType>;
+
+    if constexpr (std::is_arithmetic_v<ValueType> && std::is_invocable_v<PredicateType&, const ValueType&>)
+    {
+        size_t Result = 0;
+
+        FieldKernel_ForEachBlock(Column, 0, [&Result, &Predicate](const ValueType* Values, size_t Count) {
+            for (size_t Index = 0; Index < Count; ++Index)
+            {
+                Result += Predicate(Values[Index]) ? 1 : 0;
+            }
+        });
+
+        return Result;
+    }
+
+    const size_t Count = Column.size();
+
+    size_t Partials[4] = {};
+    size_t Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        Partials[0] += Predicate(Column[Index]) ? 1 : 0;
+        Partials[1] += Predicate(Column[Index + 1]) ? 1 : 0;
+        Partials[2] += Predicate(Column[Index + 2]) ? 1 : 0;
+        Partials[3] += Predicate(Column[Index + 3]) ? 1 : 0;
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Partials[0] += Predicate(Column[Index]) ? 1 : 0;
+    }
+
+    return (Partials[0] + Partials[1]) + (Partials[2] + Partials[3]);
+}
+
+// Count the elements of an arithmetic column equal to Value
+template <typename VarType>
+size_t FieldCount(const FieldColumnView<VarType>& Column, std::remove_cv_t<VarType> Value)
+{
+    using ValueType = std::remove_cv_t<VarType>;
+
+    static_assert(std::is_arithmetic_v<ValueType>, "FieldCount requires an arithmetic field type");
+
+    if constexpr (bHasDenseKernel<ValueType>)
+    {
+        size_t Result = 0;
+
+        FieldKernel_ForEachBlock(Column, 0, [&Result, Value](const ValueType* Values, size_t Count) {
+            Result += DenseCount(Values, Count, Value);
+        });
+
+        return Result;
+    }
+
+    return FieldCountIf(Column, [Value](const auto& Element) { return Element == Value; });
+}
+
+} // namespace NekiraReflect
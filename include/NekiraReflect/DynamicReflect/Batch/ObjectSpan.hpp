@@ -0,0 +1,57 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+
+// ======================================= 对象数组 ======================================= //
+namespace NekiraReflect
+{
+
+// 连续存放(或按固定步长存放)的一组反射对象
+struct ObjectSpan
+{
+    void*  Data = nullptr;
+    size_t Stride = 0;
+    size_t Count = 0;
+};
+
+// Make an ObjectSpan from a pointer and a count
+template <typename ClassType>
+ObjectSpan MakeObjectSpan(ClassType* Data, size_t Count, size_t Stride = sizeof(ClassType))
+{
+    return ObjectSpan{const_cast<void*>(static_cast<const void*>(Data)), Stride, Count};
+}
+
+// Make an ObjectSpan from a contiguous container(std::vector, std::array, std::span, C array)
+template <typename RangeType>
+ObjectSpan MakeObjectSpan(RangeType& Objects)
+{
+    return MakeObjectSpan(std::data(Objects), std::size(Objects));
+}
+
+} // namespace NekiraReflect
@@ -0,0 +1,143 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// ======================================= 并行批量运算的线程池 ======================================= //
+namespace NekiraReflect
+{
+
+// 并行运算的选项
+struct ParallelOptions
+{
+    // 每块的元素数，0表示按线程数自动选择(每个线程约8块)
+    size_t GrainSize = 0;
+
+    // 参与运算的线程数上限(包括调用线程)，0表示使用线程池的全部线程
+    size_t MaxThreads = 0;
+};
+
+// 反射库持有的工作窃取线程池
+// 区间按GrainSize分块，每个参与线程先领取连续的一段块，做完后从其他线程的剩余块中窃取后一半。
+// 调用线程也参与运算，并在所有块完成后返回；同一时刻只运行一个并行任务，任务内嵌套的ParallelFor串行执行
+// [INFO] 调用线程上抛出的异常会使其他线程不再领取新的块，待它们完成手头的块后再传播给调用者；
+// 工作线程中抛出的异常会终止程序
+class WorkStealingPool final
+{
+    // 每个参与线程剩余的块区间[Begin, End)，低32位为Begin，高32位为End
+    struct alignas(64) ChunkRange
+    {
+        std::atomic<uint64_t> Range{0};
+    };
+
+public:
+    using RangeFunction = void (*)(void* Context, size_t Begin, size_t End);
+
+    static WorkStealingPool& Get();
+
+    WorkStealingPool();
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // 线程池的线程数(包括调用线程)，默认为CPU的硬件线程数
+    size_t GetThreadCount() const;
+
+    // 重新设置线程数(包括调用线程)，不能在并行任务中调用
+    void SetThreadCount(size_t ThreadCount);
+
+    // 将[0, Count)分块并行执行Function(Context, Begin, End)，返回时所有块均已完成
+    void ParallelFor(size_t Count, const ParallelOptions& Options, RangeFunction Function, void* Context);
+
+    // @example:
+    // WorkStealingPool::Get().ParallelFor(Values.size(), {}, [&](size_t Begin, size_t End) { ... });
+    template <typename Callable>
+        requires std::is_invocable_v<Callable&, size_t, size_t>
+    void ParallelFor(size_t Count, const ParallelOptions& Options, Callable&& Body)
+    {
+        using BodyType = std::remove_reference_t<Callable>;
+
+        ParallelFor(
+            Count, Options, [](void* Context, size_t Begin, size_t End)
+            { (*static_cast<BodyType*>(Context))(Begin, End); }, const_cast<void*>(static_cast<const void*>(&Body)));
+    }
+
+private:
+    void StartWorkers(size_t WorkerCount);
+
+    void StopWorkers();
+
+    void WorkerLoop(size_t WorkerIndex, uint64_t SeenGeneration);
+
+    // 参与线程Participant执行自己的块，再窃取其他线程的块，直到没有剩余的块
+    void RunParticipant(size_t Participant);
+
+    bool PopChunk(size_t Participant, size_t& Chunk);
+
+    bool StealChunks(size_t Thief);
+
+private:
+    // 串行化并行任务的提交
+    std::mutex SubmitMutex;
+
+    std::mutex              StateMutex;
+    std::condition_variable WorkCondition;
+    std::condition_variable DoneCondition;
+
+    std::vector<std::thread> Workers;
+
+    // 期望的线程数(包括调用线程)，工作线程在首次并行任务时创建
+    // [INFO] 只在SubmitMutex内修改，读取时无需加锁
+    std::atomic<size_t> ThreadCount{1};
+
+    bool bStopping = false;
+
+    // 当前任务，由StateMutex保护发布，工作线程在同一把锁下读取
+    uint64_t      JobGeneration = 0;
+    RangeFunction JobFunction = nullptr;
+    void*         JobContext = nullptr;
+    size_t        JobCount = 0;
+    size_t        JobGrain = 1;
+    size_t        JobParticipants = 0;
+    size_t        PendingWorkers = 0;
+
+    // 调用线程上的任务抛出异常后，参与线程不再领取新的块
+    std::atomic<bool> bJobCancelled{false};
+
+    std::unique_ptr<ChunkRange[]> Ranges;
+};
+
+} // namespace NekiraReflect
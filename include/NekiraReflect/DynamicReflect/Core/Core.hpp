@@ -48,6 +48,8 @@
 
 #define NFUNCTION(...) __attribute__((annotate("NFunction"))) __attribute__((annotate(#__VA_ARGS__)))
 
+#define NDIRTYFIELDS() __attribute__((annotate("NDirtyFields")))
+
 #else
 
 #define NCLASS(...)
@@ -60,4 +62,6 @@
 
 #define NFUNCTION(...)
 
+#define NDIRTYFIELDS()
+
 #endif
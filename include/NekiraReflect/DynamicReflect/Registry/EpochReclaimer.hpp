@@ -0,0 +1,135 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <type_traits>
+
+
+// ======================================= 基于纪元的延迟回收 ======================================= //
+namespace NekiraReflect
+{
+
+// 读者无锁地访问共享数据，写者发布新版本后将旧版本交给回收器，
+// 直到所有可能仍在读取旧版本的读者离开后才真正释放。
+// 读者之间互不竞争：每个线程仅写入自己独占缓存行的槽位。
+class EpochReclaimer final
+{
+    // 每个读线程独占的槽位
+    struct alignas(64) ReaderSlot
+    {
+        // 0 表示该线程当前不在读取
+        std::atomic<uint64_t> Epoch{0};
+
+        // 槽位是否已被某个线程占用
+        std::atomic<bool> bInUse{false};
+
+        // 嵌套读取的深度(仅由所属线程访问)
+        uint32_t Depth = 0;
+
+        ReaderSlot* Next = nullptr;
+    };
+
+    // 待回收的对象
+    struct RetiredObject
+    {
+        uint64_t Epoch;
+        void*    Object;
+        void (*Deleter)(void*);
+    };
+
+public:
+    // 读取期间持有，析构时离开读取区
+    class ReadGuard final
+    {
+    public:
+        explicit ReadGuard(EpochReclaimer& Owner) : Slot(Owner.EnterRead())
+        {}
+
+        ~ReadGuard()
+        {
+            EpochReclaimer::LeaveRead(Slot);
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+    private:
+        ReaderSlot* Slot;
+    };
+
+    EpochReclaimer() = default;
+    ~EpochReclaimer();
+
+    EpochReclaimer(const EpochReclaimer&) = delete;
+    EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+    // 将对象交给回收器(写者调用，需由调用方保证写者之间互斥)
+    template <typename Type, typename Deleter>
+    void Retire(std::unique_ptr<Type, Deleter> Object)
+    {
+        static_assert(std::is_empty_v<Deleter>, "Only stateless deleters can be retired.");
+
+        if (Object)
+        {
+            RetireImpl(const_cast<std::remove_const_t<Type>*>(Object.release()),
+                       [](void* Ptr) { Deleter{}(static_cast<Type*>(Ptr)); });
+        }
+    }
+
+    // 释放所有已无读者可见的对象(写者调用)
+    void Collect();
+
+    // 等待当前所有读者离开后释放全部待回收对象(写者调用)
+    void Synchronize();
+
+private:
+    ReaderSlot* EnterRead();
+
+    static void LeaveRead(ReaderSlot* Slot);
+
+    ReaderSlot* AcquireSlot();
+
+    void RetireImpl(void* Object, void (*Deleter)(void*));
+
+    // 当前活跃读者中最小的纪元，无活跃读者时返回 UINT64_MAX
+    uint64_t GetMinActiveEpoch() const;
+
+private:
+    // 全局纪元，从1开始(0 保留给非活跃槽位)
+    std::atomic<uint64_t> GlobalEpoch{1};
+
+    // 读者槽位链表(只增不减，线程退出后槽位可被复用)
+    std::atomic<ReaderSlot*> SlotHead{nullptr};
+
+    // 待回收对象，按纪元递增排列
+    std::deque<RetiredObject> RetiredObjects;
+};
+
+} // namespace NekiraReflect
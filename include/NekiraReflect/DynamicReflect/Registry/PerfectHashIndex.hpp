@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+// ======================================= 最小完美哈希 ======================================= //
+namespace NekiraReflect
+{
+
+// 为一组互不相同的64位Key构建最小完美哈希(Hash and Displace)。
+// 构建后每个Key映射到[0, N)中唯一的槽位，查询只需两次混合与一次数组访问。
+// 不在集合中的Key同样会得到某个槽位，调用方需在槽位上校验Key。
+class PerfectHashIndex final
+{
+public:
+    PerfectHashIndex() = default;
+
+    // 构建索引，Keys中存在重复时返回false
+    bool Build(const std::vector<uint64_t>& Keys);
+
+    // 获取Key对应的槽位(索引为空时不可调用)
+    inline uint32_t GetSlot(uint64_t Key) const
+    {
+        const uint32_t Bucket = Reduce(Mix(Key, Salt), static_cast<uint32_t>(Seeds.size()));
+
+        return Reduce(Mix(Key, Seeds[Bucket]), SlotCount);
+    }
+
+    // 槽位数量(等于Key的数量)
+    inline uint32_t GetSlotCount() const
+    {
+        return SlotCount;
+    }
+
+    inline bool IsEmpty() const
+    {
+        return SlotCount == 0;
+    }
+
+private:
+    // SplitMix64
+    static inline uint64_t Mix(uint64_t Key, uint64_t Seed)
+    {
+        uint64_t Value = Key ^ (Seed * 0x9E3779B97F4A7C15ull);
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    // 将哈希值映射到[0, Range)，避免取模
+    static inline uint32_t Reduce(uint64_t Hash, uint32_t Range)
+    {
+        return static_cast<uint32_t>(((Hash >> 32) * Range) >> 32);
+    }
+
+    bool TryBuild(const std::vector<uint64_t>& Keys, uint64_t TrySalt);
+
+private:
+    // 每个桶的位移种子
+    std::vector<uint32_t> Seeds;
+
+    // 分桶所用的种子
+    uint64_t Salt = 0;
+
+    uint32_t SlotCount = 0;
+};
+
+} // namespace NekiraReflect
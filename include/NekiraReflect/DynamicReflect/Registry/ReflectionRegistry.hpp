@@ -25,17 +25,88 @@
 
 #pragma once
 
+#include <NekiraReflect/DynamicReflect/Registry/EpochReclaimer.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/RegistrationProfiler.hpp>
 #include <NekiraReflect/DynamicReflect/TypeCollection/CoreType.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/MetadataArena.hpp>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 
 // ======================================= 动态反射全局注册表 ======================================= //
 namespace NekiraReflect
 {
 
+// 注册表的只读快照，由写者整体发布
+struct RegistrySnapshot;
+
+// 模块句柄，用于批量注册、卸载插件中的类型
+using ModuleHandle = uint32_t;
+
+// 主模块，不属于任何插件的类型都归属于主模块，主模块不可卸载
+inline constexpr ModuleHandle MainModule = 0;
+
+// 模块记录
+struct ReflectionModule
+{
+    ReflectionModule(ModuleHandle InHandle, std::string_view InName, size_t ArenaPageSize)
+        : Handle(InHandle), Name(InName), Arena(ArenaPageSize)
+    {}
+
+    ModuleHandle Handle;
+
+    std::string Name;
+
+    // 模块的元数据内存池，卸载模块时整体释放
+    MetadataArena Arena;
+
+    // 模块注册的TypeInfo(由注册表的写锁保护)
+    // [INFO] 指针仅用于判断注册表中的Info是否仍由该模块注册，可能已被替换而失效，不能解引用
+    std::vector<std::pair<std::type_index, EnumTypeInfo*>>  Enums;
+    std::vector<std::pair<std::type_index, ClassTypeInfo*>> Classes;
+};
+
+// 延迟注册的类型：仅记录注册函数，首次查询时才执行
+struct LazyRegistration
+{
+    LazyRegistration(TypeId InId, std::string_view InName, void (*InRegister)(), ReflectionModule* InModule)
+        : Id(InId), Name(InName), Register(InRegister), Module(InModule)
+    {}
+
+    TypeId Id;
+
+    std::string_view Name;
+
+    // 构建并注册TypeInfo的函数，即ReflectionAccessor<Type>::RegisterReflection
+    void (*Register)();
+
+    // 记录时激活的模块，注册函数在该模块中执行，主模块为nullptr
+    ReflectionModule* Module;
+
+    std::once_flag Once;
+};
+
+// 读取无锁：查询只访问当前发布的快照，读者之间互不竞争。
+// 写入串行：注册、移除在写锁内修改持有TypeInfo的容器，并在需要时发布新的快照，
+// 被替换的快照与被移除的TypeInfo会在所有读者离开后才释放。
+// 封存(Seal)后，快照改为基于最小完美哈希的扁平查找表。
 class ReflectionRegistry final
 {
-    using EnumInfoMap = std::unordered_map<std::type_index, std::unique_ptr<EnumTypeInfo>>;
-    using ClassInfoMap = std::unordered_map<std::type_index, std::unique_ptr<ClassTypeInfo>>;
+    using EnumInfoMap = std::unordered_map<std::type_index, ArenaPtr<EnumTypeInfo>>;
+    using ClassInfoMap = std::unordered_map<std::type_index, ArenaPtr<ClassTypeInfo>>;
+
+    // 名称索引，Key指向TypeInfo自身持有的名称，不额外分配内存
+    using EnumNameMap = std::unordered_map<std::string_view, EnumTypeInfo*>;
+    using ClassNameMap = std::unordered_map<std::string_view, ClassTypeInfo*>;
+
+    // 延迟注册表，节点地址稳定，执行注册函数时无需持锁
+    using LazyRegistrationMap = std::unordered_map<TypeId, ArenaPtr<LazyRegistration>>;
+    using LazyRegistrationNameMap = std::unordered_map<std::string_view, LazyRegistration*>;
 
 public:
     ReflectionRegistry(const ReflectionRegistry&) = delete;
@@ -44,14 +115,22 @@ public:
     ReflectionRegistry(ReflectionRegistry&&) = delete;
     ReflectionRegistry& operator=(ReflectionRegistry&&) = delete;
 
+    ~ReflectionRegistry();
+
     // 获取单例实例
     static ReflectionRegistry& Get();
 
     // Register Enum Info
-    void RegisterEnum(std::unique_ptr<EnumTypeInfo> EnumInfo);
+    void RegisterEnum(ArenaPtr<EnumTypeInfo> EnumInfo);
 
     // Register Class Info
-    void RegisterClass(std::unique_ptr<ClassTypeInfo> ClassInfo);
+    void RegisterClass(ArenaPtr<ClassTypeInfo> ClassInfo);
+
+    // 延迟注册Enum：仅记录注册函数，首次查询该类型时才调用Register构建并注册Enum Info
+    void RegisterLazyEnum(std::type_index TypeIndex, std::string_view Name, void (*Register)());
+
+    // 延迟注册Class：仅记录注册函数，首次查询该类型时才调用Register构建并注册Class Info
+    void RegisterLazyClass(std::type_index TypeIndex, std::string_view Name, void (*Register)());
 
     // Remove Enum Info
     void RemoveEnum(std::type_index TypeIndex);
@@ -59,45 +138,265 @@ public:
     // Remove Class Info
     void RemoveClass(std::type_index TypeIndex);
 
+    // 创建模块，之后在ScopedReflectionModule的作用域内注册的类型都归属于该模块
+    // [INFO] ArenaPageSize为模块元数据内存池的单页大小，只注册少量类型的模块可以使用较小的页
+    ModuleHandle CreateModule(std::string_view Name, size_t ArenaPageSize = MetadataArena::DefaultPageSize);
+
+    // 卸载模块：一次性移除该模块注册的所有类型与延迟注册项，
+    // 并等待所有读者离开后释放它们及模块的内存池。返回后即可安全地dlclose模块。
+    // [INFO] 调用线程不能持有任何该模块的TypeInfo正在使用中
+    void UnloadModule(ModuleHandle Module);
+
+    // 获取当前线程激活的模块
+    ModuleHandle GetActiveModule() const;
+
+    // 注册表的版本号，每当有TypeInfo被注册、替换或移除时递增。
+    // 缓存TypeInfo*的调用者只需比较版本号即可判断缓存是否仍然有效
+    inline uint64_t GetGeneration() const
+    {
+        return Generation.load(std::memory_order_acquire);
+    }
+
     // Get Enum Info by TypeIndex
     EnumTypeInfo* GetEnumInfo(std::type_index TypeIndex) const;
 
+    // Get Enum Info by TypeId
+    EnumTypeInfo* GetEnumInfo(TypeId Id) const;
+
     // Get Enum Info by Enum Type
     template <typename EnumType>
     EnumTypeInfo* GetEnumInfo() const
     {
-        auto TypeIndex = std::type_index(typeid(EnumType));
-
-        return GetEnumInfo(TypeIndex);
+        return GetEnumInfo(TypeIdOf<EnumType>());
     }
 
-    // Get Enum Info by Name(Would be slower)
-    EnumTypeInfo* GetEnumInfoByName(const std::string& Name) const;
+    // Get Enum Info by Name
+    EnumTypeInfo* GetEnumInfoByName(std::string_view Name) const;
 
     // Get Class Info by TypeIndex
     ClassTypeInfo* GetClassInfo(std::type_index TypeIndex) const;
 
+    // Get Class Info by TypeId
+    ClassTypeInfo* GetClassInfo(TypeId Id) const;
+
     // Get Class Info by Class Type
     template <typename ClassType>
     ClassTypeInfo* GetClassInfo() const
     {
-        auto TypeIndex = std::type_index(typeid(ClassType));
+        return GetClassInfo(TypeIdOf<ClassType>());
+    }
 
-        return GetClassInfo(TypeIndex);
+    // Get Class Info by Name
+    ClassTypeInfo* GetClassInfoByName(std::string_view Name) const;
+
+    // 封存注册表：将所有类型信息编译为最小完美哈希的扁平查找表，之后的查询只需一次数组访问。
+    // 适用于静态初始化完成后不再注册类型的进程。
+    // 封存前会先执行所有尚未执行的延迟注册。
+    // 封存后仍可注册或移除类型，但会输出警告并在下一次发布时重建查找表。
+    void Seal();
+
+    // 注册表是否已封存
+    inline bool IsSealed() const
+    {
+        return bSealed.load(std::memory_order_relaxed);
     }
 
-    // Get Class Info by Name(Would be slower)
-    ClassTypeInfo* GetClassInfoByName(const std::string& Name) const;
+    // 记录一次类型注册的统计(定义NEKIRA_REFLECT_PROFILE_REGISTRATION时由生成代码调用)
+    void AddRegistrationRecord(RegistrationRecord Record);
+
+    // 获取所有类型注册的统计，按注册完成的顺序排列
+    std::vector<RegistrationRecord> GetRegistrationRecords() const;
+
+    // 清空类型注册的统计
+    void ClearRegistrationRecords();
+
+    // 获取当前激活模块的元数据内存池，未激活模块时为主模块的内存池
+    MetadataArena& GetArena();
+
+    // 获取主模块的元数据内存池，生命周期与注册表相同
+    MetadataArena& GetMainArena()
+    {
+        return Arena;
+    }
 
 private:
+    friend class ScopedReflectionModule;
+    friend class ScopedRegistrationBatch;
+
     ReflectionRegistry() = default;
 
+    // 查找模块，未找到时返回nullptr
+    ReflectionModule* FindModule(ModuleHandle Module) const;
+
+    // 将新注册的TypeInfo记录到当前激活的模块中(需持有写锁)
+    static void TrackInActiveModuleLocked(EnumTypeInfo* EnumInfo);
+    static void TrackInActiveModuleLocked(ClassTypeInfo* ClassInfo);
+
+    // 封存后修改注册表时输出警告
+    void WarnIfSealed(const char* Operation, std::string_view Name) const;
+
+    // 从写入端容器中取出Enum Info(需持有写锁)
+    ArenaPtr<EnumTypeInfo> ExtractEnumLocked(std::type_index TypeIndex);
+
+    // 从写入端容器中取出Class Info(需持有写锁)
+    ArenaPtr<ClassTypeInfo> ExtractClassLocked(std::type_index TypeIndex);
+
+    // 根据写入端容器构建并发布新的快照(需持有写锁)
+    void PublishLocked() const;
+
+    // 发布批量作用域内尚未发布的注册
+    void PublishPending() const;
+
+    // 构建快照中以TypeId为下标的数组(需持有写锁)
+    void BuildSnapshotArraysLocked(RegistrySnapshot& NewSnapshot) const;
+
+    // 将写入端容器复制为快照的哈希表(需持有写锁)
+    void BuildSnapshotMapsLocked(RegistrySnapshot& NewSnapshot) const;
+
+    // 为基类被注册、替换或移除的类构建并发布新的成员表，返回是否有类发布了新的成员表(需持有写锁)
+    bool LinkClassesLocked(const RegistrySnapshot& NewSnapshot) const;
+
+    // 先合并ClassInfo的基类再合并ClassInfo，Visited记录本次发布已处理的类(需持有写锁)
+    bool LinkClassLocked(ClassTypeInfo& ClassInfo, const RegistrySnapshot& NewSnapshot,
+                         std::unordered_set<const ClassTypeInfo*>& Visited) const;
+
+    // 在当前快照上执行查询，未命中且当前线程在批量作用域内有尚未发布的注册时，发布后重试
+    template <typename LookupFunc>
+    auto ReadSnapshot(LookupFunc&& Lookup) const;
+
+    // 在当前快照上执行查询，仍未命中时执行对应的延迟注册后重试
+    template <typename LookupFunc, typename FindLazyFunc>
+    auto ReadSnapshotOrResolve(LookupFunc&& Lookup, FindLazyFunc&& FindLazy) const;
+
+    // 查找延迟注册项，未找到时返回nullptr
+    LazyRegistration* FindLazyEnum(TypeId Id) const;
+    LazyRegistration* FindLazyEnumByName(std::string_view Name) const;
+    LazyRegistration* FindLazyClass(TypeId Id) const;
+    LazyRegistration* FindLazyClassByName(std::string_view Name) const;
+
+    // 执行所有尚未执行的延迟注册
+    void ResolveAllLazy();
+
 private:
+    // 反射元数据内存池
+    // [INFO] 须声明在所有持有TypeInfo的成员之前，保证最后析构
+    MetadataArena Arena;
+
+    // 模块表的锁
+    mutable std::mutex ModuleMutex;
+
+    // 下一个分配的模块句柄
+    ModuleHandle NextModule = MainModule + 1;
+
+    // 模块句柄 -> 模块记录
+    // [INFO] 与Arena相同，须声明在所有持有TypeInfo的成员之前
+    std::unordered_map<ModuleHandle, std::unique_ptr<ReflectionModule>> Modules{};
+
+    // 写锁，仅写者与发布快照时持有
+    mutable std::mutex WriteMutex;
+
+    // 当前发布的快照
+    mutable std::atomic<const RegistrySnapshot*> Snapshot{nullptr};
+
+    // 是否有在ScopedRegistrationBatch作用域内新注册的类型尚未发布
+    // [INFO] 批量作用域外的注册立即发布；作用域内的注册在最外层作用域结束时统一发布，避免每次注册都复制整个快照
+    mutable std::atomic<bool> bPendingPublish{false};
+
+    // 是否已封存
+    std::atomic<bool> bSealed{false};
+
+    // 注册表的版本号，发布快照时有类重新合并基类也会递增
+    mutable std::atomic<uint64_t> Generation{0};
+
+    // 快照与被移除的TypeInfo的延迟回收
+    mutable EpochReclaimer Reclaimer;
+
     // Enum Info
     EnumInfoMap EnumInfos{};
 
     // Class Info for Classes and Structs
     ClassInfoMap ClassInfos{};
+
+    // Enum Name -> Enum Info
+    EnumNameMap EnumNames{};
+
+    // Class Name -> Class Info
+    ClassNameMap ClassNames{};
+
+    // 延迟注册表的锁，与写锁分离，执行注册函数时不持有任何锁
+    mutable std::mutex LazyMutex;
+
+    // 是否存在延迟注册项，没有时未命中的查询无需查找延迟注册表
+    std::atomic<bool> bHasLazyRegistrations{false};
+
+    // Enum Type -> 延迟注册项
+    LazyRegistrationMap LazyEnums{};
+
+    // Class Type -> 延迟注册项
+    LazyRegistrationMap LazyClasses{};
+
+    // Enum Name -> 延迟注册项
+    LazyRegistrationNameMap LazyEnumNames{};
+
+    // Class Name -> 延迟注册项
+    LazyRegistrationNameMap LazyClassNames{};
+
+    // 注册统计的锁
+    mutable std::mutex ProfileMutex;
+
+    // 类型注册的统计
+    std::vector<RegistrationRecord> RegistrationRecords{};
+};
+
+
+// 在作用域内批量注册：期间当前线程注册的新类型不会逐个发布，而是在最外层作用域结束时一次发布，
+// 在此之前其他线程查询不到这些类型；当前线程自己的查询未命中时会先发布再重试。
+// 作用域外的每次注册都会立即发布，查询始终无锁。
+// @example:
+// {
+//     ScopedRegistrationBatch Batch;
+//     for (auto* Register : Registrations)
+//     {
+//         Register();
+//     }
+// }
+class ScopedRegistrationBatch final
+{
+public:
+    ScopedRegistrationBatch();
+
+    ~ScopedRegistrationBatch();
+
+    ScopedRegistrationBatch(const ScopedRegistrationBatch&) = delete;
+    ScopedRegistrationBatch& operator=(const ScopedRegistrationBatch&) = delete;
+};
+
+
+// 在作用域内激活模块：期间注册的类型都归属于该模块，元数据分配在模块自己的内存池中
+// 作用域同时是一个ScopedRegistrationBatch，模块的类型在作用域结束时一次发布
+// @example:
+// auto Module = ReflectionRegistry::Get().CreateModule("Plugin");
+// {
+//     ScopedReflectionModule Scope(Module);
+//     Handle = dlopen("libPlugin.so", RTLD_NOW); // 插件的静态注册在此执行
+// }
+// ...
+// ReflectionRegistry::Get().UnloadModule(Module);
+// dlclose(Handle);
+class ScopedReflectionModule final
+{
+public:
+    explicit ScopedReflectionModule(ModuleHandle Module);
+
+    ~ScopedReflectionModule();
+
+    ScopedReflectionModule(const ScopedReflectionModule&) = delete;
+    ScopedReflectionModule& operator=(const ScopedReflectionModule&) = delete;
+
+private:
+    ReflectionModule* Previous;
+
+    ScopedRegistrationBatch Batch;
 };
 
 } // namespace NekiraReflect
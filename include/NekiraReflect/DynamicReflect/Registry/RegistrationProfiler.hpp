@@ -0,0 +1,97 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+
+// ======================================= 注册耗时统计 ======================================= //
+namespace NekiraReflect
+{
+
+// 单个类型一次RegisterReflection()的统计
+struct RegistrationRecord
+{
+    // 类型的限定名
+    std::string Name;
+
+    // 耗时(纳秒)
+    uint64_t WallTimeNs = 0;
+
+    // 新建的反射元数据字节数(内存池)
+    size_t MetadataBytes = 0;
+
+    // 内存池分配次数
+    size_t MetadataAllocations = 0;
+
+    // 堆分配次数，未设置堆分配计数器时为0
+    size_t HeapAllocations = 0;
+};
+
+// 返回当前线程累计堆分配次数的函数，通常由使用者的内存分配器或operator new重载提供
+using HeapAllocationCounter = size_t (*)();
+
+// 设置堆分配计数器，传入nullptr则不统计堆分配
+void SetHeapAllocationCounter(HeapAllocationCounter Counter);
+
+// 统计结果的导出格式
+enum class ProfileDumpFormat
+{
+    CSV,
+    JSON
+};
+
+// 将注册表中记录的统计结果按耗时从高到低写入Stream
+void DumpRegistrationProfile(std::ostream& Stream, ProfileDumpFormat Format = ProfileDumpFormat::CSV);
+
+// 统计作用域：构造时记录起点，析构时将本次注册的统计写入注册表
+// 由定义了NEKIRA_REFLECT_PROFILE_REGISTRATION时的*_ACCESSOR_BEGIN宏使用
+class RegistrationProfileScope final
+{
+public:
+    explicit RegistrationProfileScope(std::string_view InName);
+
+    ~RegistrationProfileScope();
+
+    RegistrationProfileScope(const RegistrationProfileScope&) = delete;
+    RegistrationProfileScope& operator=(const RegistrationProfileScope&) = delete;
+
+private:
+    std::string_view Name;
+
+    std::chrono::steady_clock::time_point StartTime;
+
+    size_t StartMetadataBytes = 0;
+
+    size_t StartMetadataAllocations = 0;
+
+    size_t StartHeapAllocations = 0;
+};
+
+} // namespace NekiraReflect
@@ -24,11 +24,23 @@
 
 
 #pragma once
+#include <NekiraReflect/DynamicReflect/Batch/WorkStealingPool.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/DirtyFieldSet.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/FieldPath.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/InvokeFrame.hpp>
 #include <NekiraReflect/DynamicReflect/TypeCollection/MemberFuncWrapper.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/MetadataArena.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/TypeId.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/TypeOps.hpp>
 #include <any>
+#include <atomic>
 #include <cstdint>
 #include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
@@ -43,8 +55,9 @@ namespace NekiraReflect
 using EnumValuesMap = std::unordered_map<std::string, int64_t>;
 using EnumNamesMap = std::unordered_map<int64_t, std::string>;
 
-using VariableMap = std::unordered_map<std::string, std::unique_ptr<class MemberVarInfo>>;
-using FunctionMap = std::unordered_map<std::string, std::unique_ptr<class MemberFuncInfo>>;
+// Key指向成员信息自身的名称
+using VariableMap = std::unordered_map<std::string_view, ArenaPtr<class MemberVarInfo>>;
+using FunctionMap = std::unordered_map<std::string_view, ArenaPtr<class MemberFuncInfo>>;
 
 } // namespace NekiraReflect
 
@@ -72,16 +85,18 @@ enum class TypeCategory
 namespace NekiraReflect
 {
 
+// [INFO] TypeInfo不持有名称的内存，name须在TypeInfo的整个生命周期内有效。
+// 通过Make*TypeInfo/Make*Info创建时，名称会被复制到反射元数据内存池中。
 class TypeInfo
 {
 public:
-    TypeInfo(const std::string& name, std::type_index typeIndex, size_t size)
+    TypeInfo(std::string_view name, std::type_index typeIndex, size_t size)
         : Name(name), TypeIndex(typeIndex), Size(size)
     {}
 
     virtual ~TypeInfo() = default;
 
-    inline std::string GetName() const
+    inline std::string_view GetName() const
     {
         return Name;
     }
@@ -101,10 +116,22 @@ public:
         Size = size;
     }
 
+    // 类型ID，可用于数组下标查找及整数比较
+    inline TypeId GetTypeId() const
+    {
+        return Id;
+    }
+
+    inline void SetTypeId(TypeId id)
+    {
+        Id = id;
+    }
+
 private:
-    std::string     Name;
-    std::type_index TypeIndex;
-    size_t          Size;
+    std::string_view Name;
+    std::type_index  TypeIndex;
+    size_t           Size;
+    TypeId           Id = InvalidTypeId;
 };
 
 } // namespace NekiraReflect
@@ -118,7 +145,7 @@ namespace NekiraReflect
 class EnumTypeInfo final : public TypeInfo
 {
 public:
-    EnumTypeInfo(const std::string& name, std::type_index typeIndex) : TypeInfo(name, typeIndex, 0)
+    EnumTypeInfo(std::string_view name, std::type_index typeIndex) : TypeInfo(name, typeIndex, 0)
     {}
 
     // Add enum value by name and corresponding value
@@ -161,39 +188,231 @@ private:
 namespace NekiraReflect
 {
 
-class MemberVarInfo final : public TypeInfo
+// 成员变量、成员函数的标志位
+enum class MemberFlags : uint16_t
+{
+    None = 0,
+
+    // 继承自基类
+    Inherited = 1u << 0,
+};
+
+inline constexpr MemberFlags operator|(MemberFlags Lhs, MemberFlags Rhs)
+{
+    return static_cast<MemberFlags>(static_cast<uint16_t>(Lhs) | static_cast<uint16_t>(Rhs));
+}
+
+inline constexpr bool HasMemberFlag(MemberFlags Flags, MemberFlags Flag)
+{
+    return (static_cast<uint16_t>(Flags) & static_cast<uint16_t>(Flag)) != 0;
+}
+
+// 成员名称的长度以16位保存
+inline uint16_t ToMemberNameLength(std::string_view name)
+{
+    if (name.size() > UINT16_MAX)
+    {
+        std::cerr << "[NekiraReflect] Member name is too long and will be truncated: " << name.substr(0, 64) << "...\n";
+        return UINT16_MAX;
+    }
+
+    return static_cast<uint16_t>(name.size());
+}
+
+// [INFO] 成员变量描述符保持紧凑(24字节)：不继承TypeInfo也没有虚函数，名称紧随描述符存放在内存池中，
+// 不单独保存指针；类型只保存TypeId与操作表，大小由操作表给出，偏移为32位
+// [INFO] 须由MetadataArena::CreateWithTrailingName构造(见MakeMemberVarInfo)，不可复制
+class MemberVarInfo final
 {
 public:
     template <typename ClassType, typename VarType>
-    MemberVarInfo(const std::string& name, VarType ClassType::* memberPtr)
-        : TypeInfo(name, typeid(VarType), sizeof(VarType))
+    MemberVarInfo(std::string_view name, VarType ClassType::* memberPtr)
+        : Ops(NekiraReflect::GetTypeOps<VarType>()), NameLength(ToMemberNameLength(name)), Id(TypeIdOf<VarType>())
+    {
+        Offset = static_cast<uint32_t>((size_t)&(((ClassType*)0)->*memberPtr));
+    }
+
+    // Member Variable inherited from a base class, Offset is relative to the derived object
+    // 合并成员表时也以baseOffset为0、addedFlags为None复制本类自身的成员，不复制脏标记下标
+    MemberVarInfo(std::string_view name, const MemberVarInfo& baseVar, size_t baseOffset,
+                  MemberFlags addedFlags = MemberFlags::Inherited)
+        : Ops(baseVar.Ops), NameLength(ToMemberNameLength(name)), Flags(baseVar.Flags | addedFlags),
+          Offset(static_cast<uint32_t>(baseVar.Offset + baseOffset)), Id(baseVar.Id)
+    {}
+
+    MemberVarInfo(const MemberVarInfo&) = delete;
+    MemberVarInfo& operator=(const MemberVarInfo&) = delete;
+
+    // 名称存放在紧随描述符之后的内存中
+    inline std::string_view GetName() const
+    {
+        return std::string_view(reinterpret_cast<const char*>(this + 1), NameLength);
+    }
+
+    // 由TypeId反查，模块卸载后可能为typeid(void)
+    inline std::type_index GetTypeIndex() const
+    {
+        return GetTypeIndexById(Id);
+    }
+
+    inline size_t GetSize() const
     {
-        Offset = (size_t)&(((ClassType*)0)->*memberPtr);
+        return Ops->Size;
+    }
+
+    // 类型ID，可用于数组下标查找及整数比较
+    inline TypeId GetTypeId() const
+    {
+        return Id;
+    }
+
+    inline MemberFlags GetFlags() const
+    {
+        return Flags;
+    }
+
+    // 成员类型的操作表
+    inline const TypeOps* GetTypeOps() const
+    {
+        return Ops;
+    }
+
+    // Get Member Variable Offset
+    inline size_t GetOffset() const
+    {
+        return Offset;
+    }
+
+    // Whether VarType is the registered type of the member(一次整数比较)
+    template <typename VarType>
+    inline bool IsType() const
+    {
+        return TypeIdOf<VarType>() == Id;
     }
 
     // Get Member Variable Value.
+    // 定义NEKIRA_REFLECT_CHECKED_ACCESS时校验VarType，否则与GetValueUnchecked相同
     template <typename VarType>
     VarType& GetValue(void* Object) const
+    {
+        CheckAccess<VarType>();
+        return GetValueUnchecked<VarType>(Object);
+    }
+
+    // Get Member Variable Value without checking VarType
+    template <typename VarType>
+    VarType& GetValueUnchecked(void* Object) const
     {
         auto* MemberPtr = (VarType*)(((char*)Object) + Offset);
 
         return *MemberPtr;
     }
 
+    // Get Member Variable Pointer, nullptr if VarType does not match
+    template <typename VarType>
+    VarType* TryGetValue(void* Object) const
+    {
+        return IsType<VarType>() ? &GetValueUnchecked<VarType>(Object) : nullptr;
+    }
+
+    template <typename VarType>
+    const VarType* TryGetValue(const void* Object) const
+    {
+        return TryGetValue<VarType>(const_cast<void*>(Object));
+    }
+
     // Set Member Variable Value.
+    // 定义NEKIRA_REFLECT_CHECKED_ACCESS时校验VarType；所在类启用脏成员追踪时同时标记该成员
     template <typename VarType>
     void SetValue(void* Object, const VarType& Value) const
+    {
+        CheckAccess<VarType>();
+        SetValueUnchecked(Object, Value);
+    }
+
+    // Set Member Variable Value without checking VarType
+    template <typename VarType>
+    void SetValueUnchecked(void* Object, const VarType& Value) const
     {
         auto* MemberPtr = (VarType*)(((char*)Object) + Offset);
 
         *MemberPtr = Value;
+
+        MarkDirty(Object);
+    }
+
+    // Set Member Variable Value, return false if VarType does not match
+    template <typename VarType>
+    bool TrySetValue(void* Object, const VarType& Value) const
+    {
+        if (!IsType<VarType>())
+        {
+            return false;
+        }
+
+        SetValueUnchecked(Object, Value);
+        return true;
+    }
+
+    // 成员未被追踪时为InvalidDirtyIndex
+    inline uint16_t GetDirtyIndex() const
+    {
+        return DirtyIndex;
+    }
+
+    // 对象中DirtyFieldSet成员的偏移
+    inline size_t GetDirtySetOffset() const
+    {
+        return DirtySetOffset;
+    }
+
+    // 由ClassTypeInfo在启用脏成员追踪时设置
+    inline void SetDirtyTracking(uint16_t index, uint16_t setOffset)
+    {
+        DirtyIndex = index;
+        DirtySetOffset = setOffset;
+    }
+
+    // 在对象的DirtyFieldSet中标记该成员，用于通过GetValue返回的引用修改成员之后
+    inline void MarkDirty(void* Object) const
+    {
+        if (DirtyIndex != InvalidDirtyIndex)
+        {
+            reinterpret_cast<DirtyFieldSet*>(static_cast<char*>(Object) + DirtySetOffset)->Mark(DirtyIndex);
+        }
+    }
+
+    static constexpr uint16_t InvalidDirtyIndex = 0xFFFF;
+
+private:
+    template <typename VarType>
+    inline void CheckAccess() const
+    {
+        if constexpr (bCheckedMemberAccess)
+        {
+            if (!IsType<VarType>())
+            {
+                ReportTypeMismatch(GetName(), Id, TypeIdOf<VarType>());
+            }
+        }
     }
 
 private:
+    const TypeOps* Ops;
+    uint16_t       NameLength;
+    MemberFlags    Flags = MemberFlags::None;
+
     // Member Variable Offset
-    size_t Offset;
+    uint32_t Offset = 0;
+    TypeId   Id;
+
+    // 脏成员追踪，DirtySetOffset为对象中DirtyFieldSet成员的偏移
+    uint16_t DirtyIndex = InvalidDirtyIndex;
+    uint16_t DirtySetOffset = 0;
 };
 
+static_assert(sizeof(MemberVarInfo) <= 24, "MemberVarInfo should stay compact");
+
 } // namespace NekiraReflect
 
 
@@ -226,78 +445,205 @@ std::tuple<Args...> Anys_To_Tuple(const std::vector<std::any>& Params)
 // ========================================== 成员函数信息 ========================================== //
 namespace NekiraReflect
 {
-class MemberFuncInfo final : public TypeInfo
+// [INFO] 与MemberVarInfo相同，成员函数描述符不继承TypeInfo也没有虚函数
+class MemberFuncInfo final
 {
 public:
+    // 类型擦除的函数指针，调用前须转换回原类型
+    using ErasedDirectCall = void (*)();
+
+    // 批量调用入口，签名与成员函数无关
+    using BatchCallType = InvokeStatus (*)(const void*, const ObjectSpan&, size_t, size_t,
+                                           std::span<const ArgumentColumn>, const ResultColumn&);
+
     // Member Function(non-const)
     template <typename ClassType, typename RT, typename... Args>
-    MemberFuncInfo(const std::string& name, RT (ClassType::*funcPtr)(Args...))
-        : TypeInfo(name, typeid(funcPtr), sizeof(funcPtr))
+    MemberFuncInfo(std::string_view name, RT (ClassType::*funcPtr)(Args...))
+        : NameData(name.data()), NameLength(ToMemberNameLength(name)), Size(static_cast<uint32_t>(sizeof(funcPtr))),
+          Id(TypeIdOf<decltype(funcPtr)>()), SignatureId(TypeIdOf<RT(Args...)>())
     {
-        auto WrapperLambda = [funcPtr](void* Object, const std::vector<std::any>& Params) -> std::any
-        {
-            auto* ObjectPtr = static_cast<ClassType*>(Object);
-            if constexpr (std::is_void_v<RT>)
-            {
-                auto VoidLambda = [funcPtr, ObjectPtr](auto&&... args) -> void
-                { (ObjectPtr->*funcPtr)(std::forward<Args>(args)...); };
+        using CallableType = MemberFuncCallable<ClassType, decltype(funcPtr), RT, Args...>;
+
+        FuncWrapper = CallableType{funcPtr};
+        DirectCall = reinterpret_cast<ErasedDirectCall>(&CallableType::CallDirect);
+        BatchCall = &CallableType::CallBatch;
+    }
 
-                std::apply(VoidLambda, Anys_To_Tuple<Args...>(Params));
+    // Member Function(const)
+    template <typename ClassType, typename RT, typename... Args>
+    MemberFuncInfo(std::string_view name, RT (ClassType::*funcPtr)(Args...) const)
+        : NameData(name.data()), NameLength(ToMemberNameLength(name)), Size(static_cast<uint32_t>(sizeof(funcPtr))),
+          Id(TypeIdOf<decltype(funcPtr)>()), SignatureId(TypeIdOf<RT(Args...)>())
+    {
+        using CallableType = MemberFuncCallable<const ClassType, decltype(funcPtr), RT, Args...>;
 
-                return {};
-            }
-            else
-            {
-                auto AnyLambda = [funcPtr, ObjectPtr](auto&&... args) -> std::any
-                { return (ObjectPtr->*funcPtr)(std::forward<Args>(args)...); };
+        FuncWrapper = CallableType{funcPtr};
+        DirectCall = reinterpret_cast<ErasedDirectCall>(&CallableType::CallDirect);
+        BatchCall = &CallableType::CallBatch;
+    }
 
-                return std::apply(AnyLambda, Anys_To_Tuple<Args...>(Params));
-            }
-        };
+    // Member Function inherited from a base class
+    // 合并成员表时也以baseOffset为0、addedFlags为None复制本类自身的成员函数
+    MemberFuncInfo(std::string_view name, const MemberFuncInfo& baseFunc, size_t baseOffset,
+                   MemberFlags addedFlags = MemberFlags::Inherited)
+        : NameData(name.data()), NameLength(ToMemberNameLength(name)), Flags(baseFunc.Flags | addedFlags),
+          ObjectOffset(static_cast<uint32_t>(baseFunc.ObjectOffset + baseOffset)), Size(baseFunc.Size), Id(baseFunc.Id),
+          SignatureId(baseFunc.SignatureId), DirectCall(baseFunc.DirectCall), BatchCall(baseFunc.BatchCall),
+          FuncWrapper(baseFunc.FuncWrapper)
+    {}
 
-        FuncWrapper = WrapperLambda;
+    inline std::string_view GetName() const
+    {
+        return std::string_view(NameData, NameLength);
     }
 
-    // Member Function(const)
-    template <typename ClassType, typename RT, typename... Args>
-    MemberFuncInfo(const std::string& name, RT (ClassType::*funcPtr)(Args...) const)
-        : TypeInfo(name, typeid(funcPtr), sizeof(funcPtr))
+    // 由TypeId反查，模块卸载后可能为typeid(void)
+    inline std::type_index GetTypeIndex() const
     {
-        auto WrapperLambda = [funcPtr](void* Object, const std::vector<std::any>& Params) -> std::any
-        {
-            auto* ObjectPtr = static_cast<ClassType*>(Object);
-            if constexpr (std::is_void_v<RT>)
-            {
-                auto VoidLambda = [funcPtr, ObjectPtr](auto&&... args) -> void
-                { (ObjectPtr->*funcPtr)(std::forward<Args>(args)...); };
+        return GetTypeIndexById(Id);
+    }
+
+    inline size_t GetSize() const
+    {
+        return Size;
+    }
 
-                std::apply(VoidLambda, Anys_To_Tuple<Args...>(Params));
+    // 成员函数指针类型的TypeId
+    inline TypeId GetTypeId() const
+    {
+        return Id;
+    }
 
-                return {};
-            }
-            else
-            {
-                auto AnyLambda = [funcPtr, ObjectPtr](auto&&... args) -> std::any
-                { return (ObjectPtr->*funcPtr)(std::forward<Args>(args)...); };
+    inline MemberFlags GetFlags() const
+    {
+        return Flags;
+    }
 
-                return std::apply(AnyLambda, Anys_To_Tuple<Args...>(Params));
-            }
-        };
+    // 函数签名RT(Args...)的TypeId，const与非const成员函数的签名相同
+    inline TypeId GetSignatureId() const
+    {
+        return SignatureId;
+    }
 
-        FuncWrapper = WrapperLambda;
+    // 调用前对象指针的调整量
+    inline size_t GetObjectOffset() const
+    {
+        return ObjectOffset;
+    }
+
+    // 签名已知时的直接调用入口，类型为RT(*)(const void* Callable, void* Object, Args...)，由TypedInvoker还原
+    inline ErasedDirectCall GetDirectCall() const
+    {
+        return DirectCall;
+    }
+
+    // CallDirect的第一个参数，与成员函数信息的生命周期相同
+    inline const void* GetCallable() const
+    {
+        return FuncWrapper.GetCallable();
     }
 
 
     // Invoke Function
+    // [INFO] 参数经栈上的参数帧传递，返回值装箱为std::any；参数类型不匹配时输出错误并返回空的std::any
     template <typename... Args>
-    std::any Invoke(void* Object, Args&&... args)
+    std::any Invoke(void* Object, Args&&... args) const
+    {
+        std::any Result;
+
+        ResultRef ResultStorage;
+        ResultStorage.Boxed = &Result;
+
+        InvokeWithFrame(Object, ArgumentFrame<sizeof...(Args)>(args...), ResultStorage);
+
+        return Result;
+    }
+
+    // 以参数帧调用成员函数，返回值写入调用方提供的存储，稳定状态下不分配堆内存
+    // [INFO] 返回值类型须与存储类型一致；Result为空时丢弃返回值
+    bool InvokeWithFrame(void* Object, std::span<const ArgumentRef> Arguments, const ResultRef& Result = {}) const
+    {
+        const InvokeStatus Status = FuncWrapper.Invoke(static_cast<char*>(Object) + ObjectOffset, Arguments, Result);
+
+        if (Status != InvokeStatus::Success)
+        {
+            ReportInvokeFailure(Status, Arguments.size());
+            return false;
+        }
+
+        return true;
+    }
+
+    // 调用成员函数并将返回值写入Result
+    // @example:
+    // int Sum = 0;
+    // FuncInfo->InvokeInto(&Object, Sum, 1, 2);
+    template <typename RT, typename... Args>
+    bool InvokeInto(void* Object, RT& Result, Args&&... args) const
+    {
+        return InvokeWithFrame(Object, ArgumentFrame<sizeof...(Args)>(args...), MakeResultRef(Result));
+    }
+
+    // 对Objects中的每个对象调用成员函数，参数与返回值按列传递，类型在循环前统一校验一次
+    // [INFO] 参数列不短于对象数，共享参数的Stride为0；Results为空时丢弃返回值
+    bool InvokeBatch(const ObjectSpan& Objects, std::span<const ArgumentColumn> Arguments,
+                     const ResultColumn& Results = {}) const
+    {
+        ObjectSpan Adjusted = Objects;
+        Adjusted.Data = static_cast<char*>(Objects.Data) + ObjectOffset;
+
+        const InvokeStatus Status = BatchCall(GetCallable(), Adjusted, 0, Objects.Count, Arguments, Results);
+
+        if (Status != InvokeStatus::Success)
+        {
+            ReportInvokeFailure(Status, Arguments.size());
+            return false;
+        }
+
+        return true;
+    }
+
+    // 批量调用成员函数，返回值依次写入Results，参数可以是ArgumentColumn或所有对象共享的值
+    // @example:
+    // std::vector<int> Scores(Entities.size());
+    // FuncInfo->InvokeBatchInto(MakeObjectSpan(Entities), std::span(Scores), MakeArgumentColumn(std::span(Ticks)), 2.0f);
+    template <typename RT, typename... Args>
+    bool InvokeBatchInto(const ObjectSpan& Objects, std::span<RT> Results, Args&&... args) const
+    {
+        return InvokeBatch(Objects, ArgumentColumns<sizeof...(Args)>(args...), MakeResultColumn(Results));
+    }
+
+    // 在WorkStealingPool上分块并行地批量调用成员函数，返回值按对象的下标写入，与串行调用的结果位置一致
+    // [INFO] 不同对象的调用须互不依赖；共享参数被所有线程同时访问，非const引用的共享参数会产生数据竞争
+    bool InvokeBatchParallel(const ObjectSpan& Objects, std::span<const ArgumentColumn> Arguments,
+                             const ResultColumn& Results = {}, const ParallelOptions& Options = {}) const;
+
+    // 并行批量调用成员函数，返回值依次写入Results
+    template <typename RT, typename... Args>
+    bool InvokeBatchParallelInto(const ObjectSpan& Objects, std::span<RT> Results, const ParallelOptions& Options,
+                                 Args&&... args) const
     {
-        std::vector<std::any> Params{std::any(std::forward<Args>(args))...};
-        return FuncWrapper.Invoke(Object, Params);
+        return InvokeBatchParallel(Objects, ArgumentColumns<sizeof...(Args)>(args...), MakeResultColumn(Results),
+                                   Options);
     }
 
 private:
-    MemberFuncWrapper<std::any(void*, const std::vector<std::any>&)> FuncWrapper;
+    const char* NameData;
+    uint16_t    NameLength;
+    MemberFlags Flags = MemberFlags::None;
+
+    // 调用前对象指针的调整量，继承的成员函数需调整为基类子对象的地址
+    uint32_t ObjectOffset = 0;
+    uint32_t Size;
+    TypeId   Id;
+    TypeId   SignatureId;
+
+    ErasedDirectCall DirectCall = nullptr;
+    BatchCallType    BatchCall = nullptr;
+
+    MemberFuncWrapper<InvokeStatus(void*, std::span<const ArgumentRef>, const ResultRef&)> FuncWrapper;
+
+    void ReportInvokeFailure(InvokeStatus Status, size_t ArgumentCount) const;
 };
 
 } // namespace NekiraReflect
@@ -308,17 +654,40 @@ private:
 namespace NekiraReflect
 {
 
+// 基类信息
+struct BaseClassInfo
+{
+    // 基类的TypeId
+    TypeId Id = InvalidTypeId;
+
+    // 派生类指针转换为基类指针时的调整量
+    size_t Offset = 0;
+};
+
+// 紧凑的成员变量描述符，按偏移(相同偏移时按声明顺序)连续存放，便于线性遍历整个对象
+// [INFO] Name指向对应MemberVarInfo的名称，成员被移除后失效
+struct FieldDescriptor
+{
+    std::string_view Name;
+    uint32_t         Offset = 0;
+    uint32_t         Size = 0;
+    TypeId           Id = InvalidTypeId;
+    MemberFlags      Flags = MemberFlags::None;
+};
+
+// [INFO] 注册表在注册、替换、移除类型或卸载模块时(持有写锁)为有基类的类重新合并已注册反射的基类的成员，
+// 派生类的同名成员隐藏基类成员。合并生成新的扁平成员表并整体发布，已发布的成员表不再修改，查询只读取当前发布的表。
 class ClassTypeInfo final : public TypeInfo
 {
 
 
 public:
-    ClassTypeInfo(const std::string& name, std::type_index typeIndex) : TypeInfo(name, typeIndex, 0)
+    ClassTypeInfo(std::string_view name, std::type_index typeIndex) : TypeInfo(name, typeIndex, 0)
     {}
 
     // Get Variable Value
     template <typename VarType>
-    VarType GetVariableValue(void* object, const std::string& name) const
+    VarType GetVariableValue(void* object, std::string_view name) const
     {
         auto varInfo = GetVariable(name);
         return varInfo ? varInfo->GetValue<VarType>(object) : VarType{};
@@ -326,7 +695,7 @@ public:
 
     // Set Variblae Value
     template <typename VarType>
-    void SetVariableValue(void* object, const std::string& name, const VarType& value)
+    void SetVariableValue(void* object, std::string_view name, const VarType& value)
     {
         if (auto varInfo = GetVariable(name))
         {
@@ -334,49 +703,327 @@ public:
         }
     }
 
+    // Get Nested Variable Value by a dotted path such as "a.b.c"
+    // 路径无效或类型不匹配时返回默认值
+    template <typename VarType>
+    VarType GetPathValue(const void* object, std::string_view path) const
+    {
+        const FieldPath Path = GetFieldPath(path);
+        return Path.GetTypeId() == TypeIdOf<VarType>() ? Path.Get<VarType>(object) : VarType{};
+    }
+
+    // Set Nested Variable Value by a dotted path such as "a.b.c"
+    template <typename VarType>
+    void SetPathValue(void* object, std::string_view path, const VarType& value) const
+    {
+        const FieldPath Path = GetFieldPath(path);
+
+        if (Path.GetTypeId() == TypeIdOf<VarType>())
+        {
+            Path.Set(object, value);
+        }
+    }
+
+    // Get a compiled member path, 编译结果按路径缓存，反射信息变化后重新编译
+    FieldPath GetFieldPath(std::string_view path) const;
+
     // Add a member variable
-    void AddVariable(std::unique_ptr<MemberVarInfo> varInfo);
+    // [INFO] 成员的增删应在注册前完成；已合并基类成员的类在注册后修改成员，须重新注册才会出现在合并的成员表中
+    void AddVariable(ArenaPtr<MemberVarInfo> varInfo);
 
     // Add a member function
-    void AddFunction(std::unique_ptr<MemberFuncInfo> funcInfo);
+    void AddFunction(ArenaPtr<MemberFuncInfo> funcInfo);
+
+    // Set the arena that owns this class info, 继承的成员也分配在其中(由注册表在注册时设置)
+    inline void SetArena(MetadataArena* arena)
+    {
+        OwnerArena = arena;
+    }
+
+    // Add a direct base class
+    inline void AddBaseClass(const BaseClassInfo& baseInfo)
+    {
+        BaseClasses.push_back(baseInfo);
+    }
+
+    // Get all direct base classes
+    inline const std::vector<BaseClassInfo>& GetBaseClasses() const
+    {
+        return BaseClasses;
+    }
+
+    // Merge the members of the resolved direct bases, Bases[i]对应GetBaseClasses()[i]，未注册反射的基类为nullptr
+    // 在新的成员表中构建合并结果后整体发布；基类与上次合并时相同时不做任何事。返回是否发布了新的成员表
+    // [INFO] 由注册表在写锁内按基类优先的顺序调用。被替换的成员表保留到本类释放，之前取得的成员信息仍然有效
+    bool LinkBaseClasses(std::span<const ClassTypeInfo* const> Bases);
+
+    // Whether this class is the given class or derives from it
+    bool IsA(TypeId id) const;
+
+    // Whether this class is ClassType or derives from it
+    template <typename ClassType>
+    bool IsA() const
+    {
+        return IsA(TypeIdOf<ClassType>());
+    }
 
     // Get a member variable by name
-    MemberVarInfo* GetVariable(const std::string& name) const;
+    MemberVarInfo* GetVariable(std::string_view name) const;
 
     // Get a member function by name
-    MemberFuncInfo* GetFunction(const std::string& name) const;
+    MemberFuncInfo* GetFunction(std::string_view name) const;
 
     // Remove a member variable by name
-    inline void RemoveVariable(const std::string& name)
-    {
-        Variables.erase(name);
-    }
+    void RemoveVariable(std::string_view name);
 
     // Remove a member function by name
-    inline void RemoveFunction(const std::string& name)
+    inline void RemoveFunction(std::string_view name)
     {
-        Functions.erase(name);
+        Declared.Functions.erase(name);
     }
 
     // Get all member variables
     inline const VariableMap& GetAllVariables() const
     {
-        return Variables;
+        return GetMembers().Variables;
     }
 
     // Get all member functions
     inline const FunctionMap& GetAllFunctions() const
     {
-        return Functions;
+        return GetMembers().Functions;
     }
 
+    // Get all member variables as a contiguous array, ordered by offset then declaration order
+    inline std::span<const FieldDescriptor> GetFields() const
+    {
+        return GetMembers().Fields;
+    }
+
+    // Copy all reflected member variables from Src to Dst
+    // 相邻的可按字节复制的成员合并为一次memcpy，其余成员通过复制赋值；启用脏成员追踪时标记Dst的所有被追踪成员
+    void CopyObject(void* Dst, const void* Src) const;
+
+    // Enable dirty-field tracking, dirtySetOffset为对象中DirtyFieldSet成员的偏移
+    // 之后通过反射写入成员时会在该集合中标记成员，已添加与之后添加的成员都会分配脏标记下标
+    // [INFO] 会标记的写入：MemberVarInfo::SetValue、SetVariableValue、FieldHandle::Set、生成的ReflectionAccessor<T>::Set<成员名>、FieldPath::Set(路径上每个被追踪的成员)、
+    // CopyObject、ScatterField与CopyField；经GetValue、FieldHandle::Get、FieldColumnView返回的引用写入不会标记，须手动调用MarkDirty
+    void EnableDirtyTracking(size_t dirtySetOffset);
+
+    // Enable dirty-field tracking with the DirtyFieldSet member of ClassType
+    template <typename ClassType>
+    void EnableDirtyTracking(DirtyFieldSet ClassType::* dirtySet)
+    {
+        EnableDirtyTracking((size_t)&(((ClassType*)0)->*dirtySet));
+    }
+
+    // Whether dirty-field tracking is enabled(包括沿用基类的追踪)
+    inline bool IsDirtyTracked() const
+    {
+        return GetMembers().bDirtyTracked;
+    }
+
+    // Get the DirtyFieldSet of an object, nullptr if tracking is disabled
+    inline DirtyFieldSet* GetDirtyFieldSet(void* object) const
+    {
+        return GetDirtyFieldSet(GetMembers(), object);
+    }
+
+    inline const DirtyFieldSet* GetDirtyFieldSet(const void* object) const
+    {
+        return GetDirtyFieldSet(const_cast<void*>(object));
+    }
+
+    // Call func(const MemberVarInfo&) for each dirty member variable of an object
+    // 耗时与修改过的成员数成正比
+    template <typename FuncType>
+    void ForEachDirtyField(const void* object, FuncType&& func) const
+    {
+        const MemberTable& Table = GetMembers();
+
+        if (const DirtyFieldSet* DirtySet = GetDirtyFieldSet(Table, const_cast<void*>(object)))
+        {
+            DirtySet->ForEach(
+                [&Table, &func](size_t Index)
+                {
+                    // 已移除的成员不再枚举
+                    if (const MemberVarInfo* VarInfo = Table.DirtyFields[Index])
+                    {
+                        func(*VarInfo);
+                    }
+                });
+        }
+    }
+
+    // Clear all dirty marks of an object
+    inline void ClearDirtyFields(void* object) const
+    {
+        if (DirtyFieldSet* DirtySet = GetDirtyFieldSet(object))
+        {
+            DirtySet->Clear();
+        }
+    }
+
+    // Compute a 64-bit hash of all reflected member variables, stable across runs unless a member is a pointer
+    // 相邻的可按字节复制的成员合并为一次哈希，已反射的结构体成员递归哈希，指针按地址哈希，其余成员使用各自类型的哈希
+    uint64_t Hash(const void* Object, uint64_t Seed = 0) const;
+
+    // Compare all reflected member variables of Lhs and Rhs, consistent with Hash
+    // 存在无法比较的成员时(见IsComparable)总是返回false
+    bool Equals(const void* Lhs, const void* Rhs) const;
+
+    // Whether every reflected member variable can be hashed and compared
+    // 无序容器、含填充字节且未注册反射的结构体等成员无法比较，此时Equals总是返回false
+    bool IsComparable() const;
+
+    // Whether every reflected member variable can be copied by CopyObject
+    // 不可复制赋值的成员不会被CopyObject复制
+    bool IsCopyable() const;
+
 
 private:
-    // Member Variables
-    VariableMap Variables;
+    // 以std::string_view查找std::string的键，查找时不构造字符串
+    struct PathHash
+    {
+        using is_transparent = void;
+
+        inline size_t operator()(std::string_view path) const
+        {
+            return std::hash<std::string_view>{}(path);
+        }
+    };
+
+    // 已编译的成员路径及编译时注册表的Generation
+    struct CachedFieldPath
+    {
+        FieldPath Path;
+        uint64_t  Generation = 0;
+    };
+
+    // 对象计划中的一步，Ops为空时按字节处理[Offset, Offset + Size)
+    // NestedId有效时成员类型不可哈希，按该TypeId注册的类递归哈希与比较
+    struct ObjectStep
+    {
+        uint32_t       Offset = 0;
+        uint32_t       Size = 0;
+        const TypeOps* Ops = nullptr;
+        TypeId         NestedId = InvalidTypeId;
+    };
+
+    // 对象计划：CopySteps合并可按字节复制的成员，HashSteps只合并值与字节一一对应的成员
+    struct ObjectPlan
+    {
+        std::vector<ObjectStep> CopySteps;
+        std::vector<ObjectStep> HashSteps;
+
+        // 是否所有成员都可复制
+        bool bCopyable = true;
+
+        // CopyObject之后须标记的脏标记下标
+        std::vector<uint16_t> DirtyIndices;
+    };
+
+    // 成员表：成员变量、成员函数、成员变量描述符、祖先与脏成员追踪
+    // [INFO] Declared只含本类自身的成员，在注册前修改；合并基类生成的成员表发布后不再修改
+    struct MemberTable
+    {
+        // Member Variables
+        VariableMap Variables;
+
+        // Member Functions
+        FunctionMap Functions;
+
+        // Member Variable Descriptors
+        std::vector<FieldDescriptor> Fields;
+
+        // 所有已注册反射的祖先类的TypeId(升序)
+        std::vector<TypeId> Ancestors;
+
+        // 按脏标记下标索引的成员变量，已移除的成员为nullptr
+        std::vector<const MemberVarInfo*> DirtyFields;
+        size_t                            DirtySetOffset = 0;
+        bool                              bDirtyTracked = false;
+
+        // 对象计划，由Fields在首次使用时构建，Declared的成员变化时失效
+        mutable ObjectPlan        Plan;
+        mutable std::atomic<bool> bPlanValid{false};
+        mutable std::mutex        PlanMutex;
+    };
+
+    // 已合并的基类及其成员表的版本，用于判断基类是否变化
+    struct LinkedBase
+    {
+        const ClassTypeInfo* Info = nullptr;
+        uint64_t             Version = 0;
+
+        bool operator==(const LinkedBase&) const = default;
+    };
+
+    // 当前发布的成员表，没有合并过基类时即为Declared
+    inline const MemberTable& GetMembers() const
+    {
+        return *Members.load(std::memory_order_acquire);
+    }
+
+    // 按成员表获取对象的DirtyFieldSet，未启用追踪时为nullptr
+    static inline DirtyFieldSet* GetDirtyFieldSet(const MemberTable& Table, void* object)
+    {
+        return Table.bDirtyTracked
+                   ? reinterpret_cast<DirtyFieldSet*>(static_cast<char*>(object) + Table.DirtySetOffset)
+                   : nullptr;
+    }
+
+    // 在新的成员表中合并本类与基类(包括间接基类)的成员，基类的成员以调整后的偏移复制，并收集祖先的TypeId
+    ArenaPtr<MemberTable> BuildLinkedTable(std::span<const ClassTypeInfo* const> Bases) const;
+
+    // 按偏移插入成员变量描述符，相同偏移时排在已有描述符之后以保持声明顺序
+    static void InsertField(MemberTable& Table, const MemberVarInfo& varInfo);
+
+    // 移除指定名称的成员变量描述符
+    static void EraseField(MemberTable& Table, std::string_view name);
+
+    // 为成员变量分配脏标记下标，成员表未启用追踪时不做任何事
+    void TrackDirtyField(MemberTable& Table, MemberVarInfo& varInfo) const;
+
+    // 停止追踪本类自身的成员变量，其下标不再复用
+    void UntrackDirtyField(std::string_view name);
+
+    // 清空已编译的成员路径
+    void ClearFieldPathCache();
+
+    // 追加一步，与上一步首尾相接的按字节步骤合并为一步
+    static void AppendObjectStep(std::vector<ObjectStep>& Steps, const FieldDescriptor& Field, const TypeOps* Ops);
+
+    // 获取成员表的对象计划，用于复制、哈希与比较，首次调用或成员变化后重新构建
+    const ObjectPlan& GetObjectPlan(const MemberTable& Table) const;
+
+    // 获取类型不可哈希的成员对应的已注册类
+    const ClassTypeInfo* GetNestedClass(const ObjectStep& Step) const;
+
+private:
+    // 本类自身的成员
+    MemberTable Declared;
+
+    // 当前发布的成员表，指向Declared或LinkedTables的最后一个
+    std::atomic<const MemberTable*> Members{&Declared};
+
+    // 合并基类生成的成员表，被替换的表保留到本类释放，之前取得的成员信息及TypedInvoker引用的可调用对象保持有效
+    std::vector<ArenaPtr<MemberTable>> LinkedTables;
+
+    // 上次合并时的基类与本类成员表的版本，只在注册表的写锁内访问
+    std::vector<LinkedBase> LinkedBases;
+    uint64_t                LinkVersion = 0;
+
+    // 已编译的成员路径，只缓存编译成功的路径
+    mutable std::unordered_map<std::string, CachedFieldPath, PathHash, std::equal_to<>> FieldPathCache;
+    mutable std::shared_mutex                                                         FieldPathMutex;
+    std::atomic<uint64_t>                                                             FieldPathVersion{0};
+
+    // Direct Base Classes
+    std::vector<BaseClassInfo> BaseClasses;
 
-    // Member Functions
-    FunctionMap Functions;
+    // 所属模块的内存池，合并生成的成员表与继承的成员分配在其中，为空时使用主模块的内存池
+    MetadataArena* OwnerArena = nullptr;
 };
 
 } // namespace NekiraReflect
\ No newline at end of file
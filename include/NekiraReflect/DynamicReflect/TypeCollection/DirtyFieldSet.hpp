@@ -0,0 +1,140 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// ======================================= 脏成员集合 ======================================= //
+namespace NekiraReflect
+{
+
+// 记录对象中被修改过的成员变量，按类为成员分配的脏标记下标索引
+// [INFO] 两级位图：Summary的每一位表示对应的字中是否有脏标记，枚举与清除只访问有脏标记的字，
+// 耗时与修改过的成员数成正比。前64个成员存放在对象内，更多的成员首次修改时才分配内存。非线程安全。
+class DirtyFieldSet final
+{
+public:
+    // 最多可追踪的成员数
+    static constexpr size_t MaxFields = 64 * 64;
+
+    // Mark the field at Index as dirty(Index须小于MaxFields)
+    inline void Mark(size_t Index)
+    {
+        const size_t WordIndex = Index / 64;
+
+        if (WordIndex == 0)
+        {
+            InlineWord |= uint64_t(1) << Index;
+        }
+        else
+        {
+            if (ExtraWords.size() < WordIndex)
+            {
+                ExtraWords.resize(WordIndex, 0);
+            }
+
+            ExtraWords[WordIndex - 1] |= uint64_t(1) << (Index % 64);
+        }
+
+        Summary |= uint64_t(1) << WordIndex;
+    }
+
+    // Whether the field at Index is dirty
+    inline bool IsDirty(size_t Index) const
+    {
+        const size_t WordIndex = Index / 64;
+
+        if ((Summary & (uint64_t(1) << WordIndex)) == 0)
+        {
+            return false;
+        }
+
+        return (GetWord(WordIndex) & (uint64_t(1) << (Index % 64))) != 0;
+    }
+
+    // Whether any field is dirty
+    inline bool Any() const
+    {
+        return Summary != 0;
+    }
+
+    // Get the number of dirty fields
+    size_t Count() const
+    {
+        size_t Result = 0;
+
+        for (uint64_t Words = Summary; Words != 0; Words &= Words - 1)
+        {
+            Result += std::popcount(GetWord(std::countr_zero(Words)));
+        }
+
+        return Result;
+    }
+
+    // Call Func(Index) for each dirty field in ascending order
+    template <typename FuncType>
+    void ForEach(FuncType&& Func) const
+    {
+        for (uint64_t Words = Summary; Words != 0; Words &= Words - 1)
+        {
+            const size_t WordIndex = std::countr_zero(Words);
+
+            for (uint64_t Bits = GetWord(WordIndex); Bits != 0; Bits &= Bits - 1)
+            {
+                Func(WordIndex * 64 + std::countr_zero(Bits));
+            }
+        }
+    }
+
+    // Clear all dirty marks
+    void Clear()
+    {
+        // 只清除有脏标记的字，保留已分配的内存供下次使用
+        for (uint64_t Words = Summary & ~uint64_t(1); Words != 0; Words &= Words - 1)
+        {
+            ExtraWords[std::countr_zero(Words) - 1] = 0;
+        }
+
+        InlineWord = 0;
+        Summary = 0;
+    }
+
+private:
+    inline uint64_t GetWord(size_t WordIndex) const
+    {
+        return WordIndex == 0 ? InlineWord : ExtraWords[WordIndex - 1];
+    }
+
+private:
+    uint64_t              Summary = 0;
+    uint64_t              InlineWord = 0;
+    std::vector<uint64_t> ExtraWords;
+};
+
+} // namespace NekiraReflect
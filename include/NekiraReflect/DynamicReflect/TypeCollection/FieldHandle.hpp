@@ -0,0 +1,245 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/TypeCollection/CoreType.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+
+
+// ======================================= 类型化的成员变量句柄 ======================================= //
+namespace NekiraReflect
+{
+
+// 定义在Utilities.hpp中，此处声明以避免循环包含
+uint64_t       GetRegistryGeneration();
+ClassTypeInfo* GetNClass(TypeId Id);
+
+// 预先解析的成员变量句柄，只保存偏移与已校验的TypeId(及脏标记下标)，访问时仅做指针运算
+// [INFO] 解析失败(类信息为空、成员不存在或类型不匹配)时句柄无效，对无效句柄调用Get/Set是未定义行为
+// [INFO] 句柄记录所在类的TypeId、成员名称与解析时注册表的Generation。所在类被替换、移除或重新合并基类后，
+// IsCurrent()会重新查找该成员并与句柄比较，不一致时须调用Refresh()重新解析；
+// 定义NEKIRA_REFLECT_CHECKED_ACCESS时，Get/Set会在句柄过期时输出错误并终止程序
+// @example:
+// FieldHandle<std::string> NameField(GetNClass<Nekira::Test::SampleClass>(), "Name");
+// if (NameField)
+// {
+//     NameField.Get(&Object) = "Nekira";
+// }
+template <typename VarType>
+class FieldHandle final
+{
+    static_assert(!std::is_reference_v<VarType>, "FieldHandle cannot refer to a reference member");
+
+public:
+    FieldHandle() = default;
+
+    FieldHandle(const ClassTypeInfo* classInfo, std::string_view name)
+        : Name(name), CheckedGeneration(GetRegistryGeneration())
+    {
+        if (classInfo != nullptr)
+        {
+            OwnerId = classInfo->GetTypeId();
+            Resolve(classInfo);
+        }
+    }
+
+    FieldHandle(const FieldHandle& Other)
+        : Offset(Other.Offset), Id(Other.Id), DirtyIndex(Other.DirtyIndex), DirtySetOffset(Other.DirtySetOffset),
+          OwnerId(Other.OwnerId), Name(Other.Name),
+          CheckedGeneration(Other.CheckedGeneration.load(std::memory_order_relaxed))
+    {}
+
+    FieldHandle& operator=(const FieldHandle& Other)
+    {
+        Offset = Other.Offset;
+        Id = Other.Id;
+        DirtyIndex = Other.DirtyIndex;
+        DirtySetOffset = Other.DirtySetOffset;
+        OwnerId = Other.OwnerId;
+        Name = Other.Name;
+        CheckedGeneration.store(Other.CheckedGeneration.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        return *this;
+    }
+
+    // Whether the handle has been resolved
+    inline bool IsValid() const
+    {
+        return Id != InvalidTypeId;
+    }
+
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    // 句柄是否仍与当前注册的所在类一致
+    // 注册表的Generation未变化时只需一次比较；变化后重新查找成员，偏移、类型与脏标记均未变化时仍然有效
+    bool IsCurrent() const
+    {
+        // 须在查找前读取Generation，查找期间发生的变化会在下次检查时重新比较
+        const uint64_t Generation = GetRegistryGeneration();
+
+        if (!IsValid())
+        {
+            return false;
+        }
+
+        if (CheckedGeneration.load(std::memory_order_acquire) == Generation)
+        {
+            return true;
+        }
+
+        const ClassTypeInfo* Owner = GetNClass(OwnerId);
+        const MemberVarInfo* varInfo = Owner != nullptr ? Owner->GetVariable(Name) : nullptr;
+
+        if (varInfo == nullptr || varInfo->GetTypeId() != Id || varInfo->GetOffset() != Offset
+            || varInfo->GetDirtyIndex() != DirtyIndex || varInfo->GetDirtySetOffset() != DirtySetOffset)
+        {
+            return false;
+        }
+
+        CheckedGeneration.store(Generation, std::memory_order_release);
+        return true;
+    }
+
+    // 按记录的所在类与成员名称重新解析，返回解析后句柄是否有效
+    // [INFO] 与Get/Set并发调用是未定义行为
+    bool Refresh()
+    {
+        CheckedGeneration.store(GetRegistryGeneration(), std::memory_order_relaxed);
+
+        Offset = 0;
+        Id = InvalidTypeId;
+        DirtyIndex = MemberVarInfo::InvalidDirtyIndex;
+        DirtySetOffset = 0;
+
+        Resolve(GetNClass(OwnerId));
+
+        return IsValid();
+    }
+
+    // Get Member Variable Reference
+    inline VarType& Get(void* Object) const
+    {
+        CheckCurrent();
+        return *reinterpret_cast<VarType*>(static_cast<char*>(Object) + Offset);
+    }
+
+    // Get Member Variable Reference(const)
+    inline const VarType& Get(const void* Object) const
+    {
+        CheckCurrent();
+        return *reinterpret_cast<const VarType*>(static_cast<const char*>(Object) + Offset);
+    }
+
+    // Set Member Variable Value
+    // 所在类启用脏成员追踪时同时标记该成员，通过Get返回的引用修改则不会标记
+    inline void Set(void* Object, const VarType& Value) const
+    {
+        Get(Object) = Value;
+        MarkDirty(Object);
+    }
+
+    // Mark the member dirty in Object without writing it
+    // 所在类未启用脏成员追踪或句柄无效时什么也不做
+    inline void MarkDirty(void* Object) const
+    {
+        if (DirtyIndex != MemberVarInfo::InvalidDirtyIndex)
+        {
+            CheckCurrent();
+            reinterpret_cast<DirtyFieldSet*>(static_cast<char*>(Object) + DirtySetOffset)->Mark(DirtyIndex);
+        }
+    }
+
+    // Get Member Variable Offset
+    inline size_t GetOffset() const
+    {
+        return Offset;
+    }
+
+    // Get Member Variable TypeId
+    inline TypeId GetTypeId() const
+    {
+        return Id;
+    }
+
+private:
+    // 从所在类解析成员，失败时句柄保持无效
+    void Resolve(const ClassTypeInfo* classInfo)
+    {
+        const MemberVarInfo* varInfo = classInfo ? classInfo->GetVariable(Name) : nullptr;
+
+        if (varInfo == nullptr)
+        {
+            return;
+        }
+
+        // TypeId与std::type_index一致，忽略顶层的const/volatile
+        if (varInfo->GetTypeId() != TypeIdOf<VarType>())
+        {
+            std::cerr << "[NekiraReflect] FieldHandle type mismatch for member " << Name << " of "
+                      << classInfo->GetName() << ".\n";
+            return;
+        }
+
+        Offset = varInfo->GetOffset();
+        Id = varInfo->GetTypeId();
+        DirtyIndex = varInfo->GetDirtyIndex();
+        DirtySetOffset = static_cast<uint16_t>(varInfo->GetDirtySetOffset());
+    }
+
+    inline void CheckCurrent() const
+    {
+        if constexpr (bCheckedMemberAccess)
+        {
+            if (!IsCurrent())
+            {
+                std::cerr << "[NekiraReflect] FieldHandle for member " << Name
+                          << " is invalid or stale, call Refresh() after its class changes.\n";
+                std::abort();
+            }
+        }
+    }
+
+private:
+    size_t   Offset = 0;
+    TypeId   Id = InvalidTypeId;
+    uint16_t DirtyIndex = MemberVarInfo::InvalidDirtyIndex;
+    uint16_t DirtySetOffset = 0;
+
+    // 所在类的TypeId与成员名称，用于重新解析
+    TypeId      OwnerId = InvalidTypeId;
+    std::string Name;
+
+    // 最近一次确认句柄有效时注册表的Generation
+    mutable std::atomic<uint64_t> CheckedGeneration{0};
+};
+
+} // namespace NekiraReflect
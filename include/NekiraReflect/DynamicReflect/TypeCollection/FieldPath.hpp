@@ -0,0 +1,159 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/TypeCollection/DirtyFieldSet.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/TypeId.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+// ======================================= 编译后的成员路径 ======================================= //
+namespace NekiraReflect
+{
+
+class ClassTypeInfo;
+
+// 将"a.b.c"形式的嵌套成员路径编译为一个累计偏移与最终成员的TypeId，访问时只做一次加法与解引用
+// [INFO] 路径中间的成员须按值嵌入且其类型已注册反射，不支持经过指针成员。
+// 编译结果依赖编译时的反射信息，类型被替换或移除后须重新编译(ClassTypeInfo::GetFieldPath会自动处理)
+// @example:
+// auto PositionX = FieldPath::Compile(GetNClass<Player>(), "Transform.Position.X");
+// if (PositionX)
+// {
+//     PositionX.Get<float>(&Object) = 1.0f;
+// }
+class FieldPath final
+{
+public:
+    FieldPath() = default;
+
+    // Compile a dotted member path against ClassInfo, 失败时返回无效路径并输出原因
+    static FieldPath Compile(const ClassTypeInfo* ClassInfo, std::string_view Path);
+
+    // Whether the path has been compiled successfully
+    inline bool IsValid() const
+    {
+        return Id != InvalidTypeId;
+    }
+
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    // Get the cumulative offset from the root object
+    inline size_t GetOffset() const
+    {
+        return Offset;
+    }
+
+    // Get the TypeId of the last member
+    inline TypeId GetTypeId() const
+    {
+        return Id;
+    }
+
+    // Get the address of the last member
+    inline void* Resolve(void* Object) const
+    {
+        return static_cast<char*>(Object) + Offset;
+    }
+
+    inline const void* Resolve(const void* Object) const
+    {
+        return static_cast<const char*>(Object) + Offset;
+    }
+
+    // Get Member Variable Reference
+    // 定义NEKIRA_REFLECT_CHECKED_ACCESS时校验VarType
+    template <typename VarType>
+    VarType& Get(void* Object) const
+    {
+        CheckAccess<VarType>();
+        return *static_cast<VarType*>(Resolve(Object));
+    }
+
+    // Get Member Variable Reference(const)
+    template <typename VarType>
+    const VarType& Get(const void* Object) const
+    {
+        CheckAccess<VarType>();
+        return *static_cast<const VarType*>(Resolve(Object));
+    }
+
+    // Get Member Variable Pointer, nullptr if the path is invalid or VarType does not match
+    template <typename VarType>
+    VarType* TryGet(void* Object) const
+    {
+        return TypeIdOf<VarType>() == Id ? static_cast<VarType*>(Resolve(Object)) : nullptr;
+    }
+
+    // Set Member Variable Value
+    // 路径上各层对象启用脏成员追踪时，分别标记该层被经过的成员
+    template <typename VarType>
+    void Set(void* Object, const VarType& Value) const
+    {
+        Get<VarType>(Object) = Value;
+
+        for (size_t Index = 0; Index < DirtyHopCount; ++Index)
+        {
+            const DirtyHop& Hop = DirtyHops[Index];
+            reinterpret_cast<DirtyFieldSet*>(static_cast<char*>(Object) + Hop.SetOffset)->Mark(Hop.Index);
+        }
+    }
+
+    // 最多记录的被追踪成员层数
+    static constexpr size_t MaxDirtyHops = 4;
+
+private:
+    template <typename VarType>
+    inline void CheckAccess() const
+    {
+        if constexpr (bCheckedMemberAccess)
+        {
+            if (TypeIdOf<VarType>() != Id)
+            {
+                ReportTypeMismatch("<FieldPath>", Id, TypeIdOf<VarType>());
+            }
+        }
+    }
+
+    // 一层被追踪的成员，SetOffset为该层DirtyFieldSet相对根对象的偏移
+    struct DirtyHop
+    {
+        uint32_t SetOffset = 0;
+        uint16_t Index = 0;
+    };
+
+    size_t                             Offset = 0;
+    TypeId                             Id = InvalidTypeId;
+    std::array<DirtyHop, MaxDirtyHops> DirtyHops{};
+    uint8_t                            DirtyHopCount = 0;
+};
+
+} // namespace NekiraReflect
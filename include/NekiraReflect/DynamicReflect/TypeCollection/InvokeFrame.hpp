@@ -0,0 +1,513 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/Batch/ObjectSpan.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/TypeId.hpp>
+#include <any>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+
+// ======================================= 零分配调用的参数帧 ======================================= //
+namespace NekiraReflect
+{
+
+// 参数帧中的一个参数：调用方参数对象的地址与TypeId，不复制参数
+struct ArgumentRef
+{
+    void*  Data = nullptr;
+    TypeId Id = InvalidTypeId;
+
+    // const参数不能绑定到非const引用形参
+    bool bConst = false;
+};
+
+// 调用方提供的返回值存储，Data须指向已构造的返回类型对象，返回值通过赋值写入
+// [INFO] Boxed仅供MemberFuncInfo::Invoke将返回值装箱为std::any
+struct ResultRef
+{
+    void*     Data = nullptr;
+    TypeId    Id = InvalidTypeId;
+    std::any* Boxed = nullptr;
+};
+
+// 调用结果
+enum class InvokeStatus
+{
+    Success,
+    ArgumentCountMismatch,
+    ArgumentTypeMismatch,
+    ResultTypeMismatch,
+    ColumnSizeMismatch
+};
+
+// Make an argument reference to Value
+template <typename Type>
+ArgumentRef MakeArgumentRef(Type& Value)
+{
+    ArgumentRef Result;
+    Result.Data = const_cast<std::remove_const_t<Type>*>(std::addressof(Value));
+    Result.Id = TypeIdOf<Type>();
+    Result.bConst = std::is_const_v<Type>;
+    return Result;
+}
+
+// Make a result reference to Value
+template <typename Type>
+ResultRef MakeResultRef(Type& Value)
+{
+    static_assert(!std::is_const_v<Type>, "Result storage must be writable");
+
+    ResultRef Result;
+    Result.Data = std::addressof(Value);
+    Result.Id = TypeIdOf<Type>();
+    return Result;
+}
+
+// 固定数量参数的参数帧，位于调用方的栈上
+// [INFO] 只保存参数的地址，参数须在调用结束前有效；数组参数按指针传递，退化后的指针保存在帧内，因此帧不可复制
+// @example:
+// int Result = 0;
+// FuncInfo->InvokeWithFrame(&Object, ArgumentFrame(1, Name), MakeResultRef(Result));
+template <size_t Count>
+class ArgumentFrame final
+{
+public:
+    template <typename... Args>
+        requires(sizeof...(Args) == Count)
+    explicit ArgumentFrame(Args&&... args)
+    {
+        size_t Index = 0;
+        (Bind(Index++, args), ...);
+    }
+
+    ArgumentFrame(const ArgumentFrame&) = delete;
+    ArgumentFrame& operator=(const ArgumentFrame&) = delete;
+
+    inline std::span<const ArgumentRef> GetArguments() const
+    {
+        return Arguments;
+    }
+
+    operator std::span<const ArgumentRef>() const
+    {
+        return Arguments;
+    }
+
+private:
+    template <typename Type>
+    void Bind(size_t Index, Type& Value)
+    {
+        if constexpr (std::is_array_v<Type>)
+        {
+            DecayedPointers[Index] = Value;
+            Arguments[Index] = MakeArgumentRef(DecayedPointers[Index]);
+            Arguments[Index].Id = TypeIdOf<std::decay_t<Type>>();
+        }
+        else
+        {
+            Arguments[Index] = MakeArgumentRef(Value);
+        }
+    }
+
+private:
+    std::array<ArgumentRef, Count> Arguments;
+    std::array<const void*, Count> DecayedPointers{};
+};
+
+template <typename... Args>
+ArgumentFrame(Args&&...) -> ArgumentFrame<sizeof...(Args)>;
+
+// 检查参数能否传给ArgType类型的形参
+template <typename ArgType>
+bool MatchArgument(const ArgumentRef& Argument)
+{
+    if (Argument.Id != TypeIdOf<ArgType>())
+    {
+        return false;
+    }
+
+    constexpr bool bNeedsMutable = std::is_reference_v<ArgType> && !std::is_const_v<std::remove_reference_t<ArgType>>;
+
+    return !(bNeedsMutable && Argument.bConst);
+}
+
+// 按形参类型取出参数：右值引用形参移动参数，其余形参以左值传入(按值传递时复制)
+template <typename ArgType>
+decltype(auto) UnpackArgument(const ArgumentRef& Argument)
+{
+    auto* Value = static_cast<std::remove_cvref_t<ArgType>*>(Argument.Data);
+
+    if constexpr (std::is_rvalue_reference_v<ArgType>)
+    {
+        return std::move(*Value);
+    }
+    else
+    {
+        return (*Value);
+    }
+}
+
+// 校验参数帧与返回值存储后调用成员函数，返回值赋值给Result.Data或装箱到Result.Boxed
+template <typename ClassType, typename RT, typename... Args, typename FuncPtrType, size_t... Indices>
+InvokeStatus InvokeMemberFunction_Impl(FuncPtrType FuncPtr, void* Object, std::span<const ArgumentRef> Arguments,
+                                       const ResultRef& Result, std::index_sequence<Indices...>)
+{
+    if (Arguments.size() != sizeof...(Args))
+    {
+        return InvokeStatus::ArgumentCountMismatch;
+    }
+
+    if (!(MatchArgument<Args>(Arguments[Indices]) && ...))
+    {
+        return InvokeStatus::ArgumentTypeMismatch;
+    }
+
+    auto* ObjectPtr = static_cast<ClassType*>(Object);
+
+    if constexpr (std::is_void_v<RT>)
+    {
+        (ObjectPtr->*FuncPtr)(UnpackArgument<Args>(Arguments[Indices])...);
+    }
+    else
+    {
+        using ValueType = std::remove_cvref_t<RT>;
+
+        if (Result.Data != nullptr)
+        {
+            if constexpr (std::is_assignable_v<ValueType&, RT>)
+            {
+                if (Result.Id != TypeIdOf<ValueType>())
+                {
+                    return InvokeStatus::ResultTypeMismatch;
+                }
+
+                *static_cast<ValueType*>(Result.Data) = (ObjectPtr->*FuncPtr)(UnpackArgument<Args>(Arguments[Indices])...);
+            }
+            else
+            {
+                return InvokeStatus::ResultTypeMismatch;
+            }
+        }
+        else if (Result.Boxed != nullptr)
+        {
+            *Result.Boxed = std::any((ObjectPtr->*FuncPtr)(UnpackArgument<Args>(Arguments[Indices])...));
+        }
+        else
+        {
+            (ObjectPtr->*FuncPtr)(UnpackArgument<Args>(Arguments[Indices])...);
+        }
+    }
+
+    return InvokeStatus::Success;
+}
+
+template <typename ClassType, typename RT, typename... Args, typename FuncPtrType>
+InvokeStatus InvokeMemberFunction(FuncPtrType FuncPtr, void* Object, std::span<const ArgumentRef> Arguments,
+                                  const ResultRef& Result)
+{
+    return InvokeMemberFunction_Impl<ClassType, RT, Args...>(FuncPtr, Object, Arguments, Result,
+                                                             std::index_sequence_for<Args...>{});
+}
+
+} // namespace NekiraReflect
+
+
+
+// ======================================= 批量调用的参数列 ======================================= //
+namespace NekiraReflect
+{
+
+// 批量调用中一个形参的参数列，第i个对象的参数位于 Data + i * Stride
+// [INFO] Stride为0时所有对象共享同一个参数，此时Count被忽略
+struct ArgumentColumn
+{
+    void*  Data = nullptr;
+    size_t Stride = 0;
+    size_t Count = 0;
+    TypeId Id = InvalidTypeId;
+    bool   bConst = false;
+};
+
+// 批量调用的返回值列，第i个对象的返回值赋值给 Data + i * Stride 处已构造的对象
+struct ResultColumn
+{
+    void*  Data = nullptr;
+    size_t Stride = 0;
+    size_t Count = 0;
+    TypeId Id = InvalidTypeId;
+};
+
+// Make a per-object argument column from contiguous values
+template <typename Type>
+ArgumentColumn MakeArgumentColumn(std::span<Type> Values)
+{
+    ArgumentColumn Result;
+    Result.Data = const_cast<std::remove_const_t<Type>*>(Values.data());
+    Result.Stride = sizeof(Type);
+    Result.Count = Values.size();
+    Result.Id = TypeIdOf<Type>();
+    Result.bConst = std::is_const_v<Type>;
+    return Result;
+}
+
+// Make an argument shared by every object
+template <typename Type>
+ArgumentColumn MakeSharedArgument(Type& Value)
+{
+    const ArgumentRef Argument = MakeArgumentRef(Value);
+
+    ArgumentColumn Result;
+    Result.Data = Argument.Data;
+    Result.Id = Argument.Id;
+    Result.bConst = Argument.bConst;
+    return Result;
+}
+
+// Make a result column from contiguous storage
+template <typename Type>
+ResultColumn MakeResultColumn(std::span<Type> Values)
+{
+    static_assert(!std::is_const_v<Type>, "Result storage must be writable");
+
+    ResultColumn Result;
+    Result.Data = Values.data();
+    Result.Stride = sizeof(Type);
+    Result.Count = Values.size();
+    Result.Id = TypeIdOf<Type>();
+    return Result;
+}
+
+// 批量调用的参数包，ArgumentColumn原样传入，其余参数作为所有对象共享的参数
+// [INFO] 与ArgumentFrame相同，只保存参数的地址，不可复制
+// @example:
+// FuncInfo->InvokeBatch(MakeObjectSpan(Entities), ArgumentColumns(MakeArgumentColumn(std::span(DeltaTimes)), Scale),
+//                       MakeResultColumn(std::span(Results)));
+template <size_t Count>
+class ArgumentColumns final
+{
+public:
+    template <typename... Args>
+        requires(sizeof...(Args) == Count)
+    explicit ArgumentColumns(Args&&... args)
+    {
+        size_t Index = 0;
+        (Bind(Index++, args), ...);
+    }
+
+    ArgumentColumns(const ArgumentColumns&) = delete;
+    ArgumentColumns& operator=(const ArgumentColumns&) = delete;
+
+    inline std::span<const ArgumentColumn> GetColumns() const
+    {
+        return Columns;
+    }
+
+    operator std::span<const ArgumentColumn>() const
+    {
+        return Columns;
+    }
+
+private:
+    template <typename Type>
+    void Bind(size_t Index, Type& Value)
+    {
+        if constexpr (std::is_same_v<std::remove_const_t<Type>, ArgumentColumn>)
+        {
+            Columns[Index] = Value;
+        }
+        else if constexpr (std::is_array_v<Type>)
+        {
+            DecayedPointers[Index] = Value;
+            Columns[Index] = MakeSharedArgument(DecayedPointers[Index]);
+            Columns[Index].Id = TypeIdOf<std::decay_t<Type>>();
+        }
+        else
+        {
+            Columns[Index] = MakeSharedArgument(Value);
+        }
+    }
+
+private:
+    std::array<ArgumentColumn, Count> Columns;
+    std::array<const void*, Count>    DecayedPointers{};
+};
+
+template <typename... Args>
+ArgumentColumns(Args&&...) -> ArgumentColumns<sizeof...(Args)>;
+
+// 检查参数列能否传给ArgType类型的形参
+// [INFO] 右值引用形参会移动参数，因此不接受共享参数
+template <typename ArgType>
+bool MatchArgumentColumn(const ArgumentColumn& Column)
+{
+    const ArgumentRef Argument{Column.Data, Column.Id, Column.bConst};
+
+    if (!MatchArgument<ArgType>(Argument))
+    {
+        return false;
+    }
+
+    return !(std::is_rvalue_reference_v<ArgType> && (Column.Stride == 0 || Column.bConst));
+}
+
+// 返回值能否赋值给去掉cv与引用的返回类型的对象
+template <typename RT>
+constexpr bool IsResultAssignable()
+{
+    if constexpr (std::is_void_v<RT>)
+    {
+        return false;
+    }
+    else
+    {
+        return std::is_assignable_v<std::remove_cvref_t<RT>&, RT>;
+    }
+}
+
+// 对Objects中下标位于[Begin, End)的对象依次调用成员函数，参数列与返回值列按整个Objects在调用前统一校验
+// [INFO] Begin == End时只做校验，并行调用借此在分块前校验一次
+template <typename ClassType, typename RT, typename... Args, typename FuncPtrType, size_t... Indices>
+InvokeStatus InvokeMemberFunctionBatch_Impl(FuncPtrType FuncPtr, const ObjectSpan& Objects, size_t Begin, size_t End,
+                                            std::span<const ArgumentColumn> Arguments, const ResultColumn& Results,
+                                            std::index_sequence<Indices...>)
+{
+    if (Arguments.size() != sizeof...(Args))
+    {
+        return InvokeStatus::ArgumentCountMismatch;
+    }
+
+    if (!(MatchArgumentColumn<Args>(Arguments[Indices]) && ...))
+    {
+        return InvokeStatus::ArgumentTypeMismatch;
+    }
+
+    if (!((Arguments[Indices].Stride == 0 || Arguments[Indices].Count >= Objects.Count) && ...))
+    {
+        return InvokeStatus::ColumnSizeMismatch;
+    }
+
+    using ValueType = std::remove_cvref_t<RT>;
+
+    if (Results.Data != nullptr)
+    {
+        if constexpr (!IsResultAssignable<RT>())
+        {
+            return InvokeStatus::ResultTypeMismatch;
+        }
+        else if (Results.Id != TypeIdOf<ValueType>())
+        {
+            return InvokeStatus::ResultTypeMismatch;
+        }
+
+        if (Results.Count < Objects.Count)
+        {
+            return InvokeStatus::ColumnSizeMismatch;
+        }
+    }
+
+    // 循环中只使用局部变量，避免写入返回值后重新读取参数列
+    [[maybe_unused]] const std::array<char*, sizeof...(Args)>  ArgumentData{static_cast<char*>(Arguments[Indices].Data)...};
+    [[maybe_unused]] const std::array<size_t, sizeof...(Args)> ArgumentStride{Arguments[Indices].Stride...};
+
+    char*        Object = static_cast<char*>(Objects.Data);
+    const size_t Stride = Objects.Stride;
+
+    if constexpr (IsResultAssignable<RT>())
+    {
+        if (Results.Data != nullptr)
+        {
+            char*        ResultData = static_cast<char*>(Results.Data);
+            const size_t ResultStride = Results.Stride;
+
+            for (size_t Index = Begin; Index < End; ++Index)
+            {
+                *reinterpret_cast<ValueType*>(ResultData + Index * ResultStride) =
+                    (reinterpret_cast<ClassType*>(Object + Index * Stride)->*FuncPtr)(UnpackArgument<Args>(
+                        ArgumentRef{ArgumentData[Indices] + Index * ArgumentStride[Indices]})...);
+            }
+
+            return InvokeStatus::Success;
+        }
+    }
+
+    for (size_t Index = Begin; Index < End; ++Index)
+    {
+        (reinterpret_cast<ClassType*>(Object + Index * Stride)->*FuncPtr)(
+            UnpackArgument<Args>(ArgumentRef{ArgumentData[Indices] + Index * ArgumentStride[Indices]})...);
+    }
+
+    return InvokeStatus::Success;
+}
+
+template <typename ClassType, typename RT, typename... Args, typename FuncPtrType>
+InvokeStatus InvokeMemberFunctionBatch(FuncPtrType FuncPtr, const ObjectSpan& Objects, size_t Begin, size_t End,
+                                       std::span<const ArgumentColumn> Arguments, const ResultColumn& Results)
+{
+    return InvokeMemberFunctionBatch_Impl<ClassType, RT, Args...>(FuncPtr, Objects, Begin, End, Arguments, Results,
+                                                                  std::index_sequence_for<Args...>{});
+}
+
+} // namespace NekiraReflect
+
+
+
+// ======================================= 成员函数的可调用对象 ======================================= //
+namespace NekiraReflect
+{
+
+// 成员函数的可调用对象，保存成员函数指针
+// 参数帧调用经operator()，批量调用经CallBatch，已知签名的直接调用经CallDirect(TypedInvoker)
+// [INFO] const成员函数的ClassType为const限定的类型
+template <typename ClassType, typename FuncPtrType, typename RT, typename... Args>
+struct MemberFuncCallable
+{
+    FuncPtrType FuncPtr;
+
+    InvokeStatus operator()(void* Object, std::span<const ArgumentRef> Arguments, const ResultRef& Result) const
+    {
+        return InvokeMemberFunction<ClassType, RT, Args...>(FuncPtr, Object, Arguments, Result);
+    }
+
+    // Callable指向MemberFuncCallable自身
+    static InvokeStatus CallBatch(const void* Callable, const ObjectSpan& Objects, size_t Begin, size_t End,
+                                  std::span<const ArgumentColumn> Arguments, const ResultColumn& Results)
+    {
+        const FuncPtrType Func = static_cast<const MemberFuncCallable*>(Callable)->FuncPtr;
+        return InvokeMemberFunctionBatch<ClassType, RT, Args...>(Func, Objects, Begin, End, Arguments, Results);
+    }
+
+    static RT CallDirect(const void* Callable, void* Object, Args... args)
+    {
+        const FuncPtrType Func = static_cast<const MemberFuncCallable*>(Callable)->FuncPtr;
+        return (static_cast<ClassType*>(Object)->*Func)(std::forward<Args>(args)...);
+    }
+};
+
+} // namespace NekiraReflect
@@ -24,65 +24,242 @@
 
 
 #pragma once
-#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 
 namespace NekiraReflect
 {
+template <typename T>
+struct MemberFuncWrapper;
+
+// 可调用对象内联保存在包装器中，经函数指针跳板调用，不分配堆内存也没有虚函数
+// [INFO] 超过InlineSize或对齐要求更高的可调用对象退回到堆上保存；复制包装器时复制可调用对象(继承的成员函数)
 template <typename RT, typename... Args>
-struct MemberFuncWrapper_Base
+struct MemberFuncWrapper<RT(Args...)>
 {
-    virtual ~MemberFuncWrapper_Base() = default;
+    // 足以保存只捕获一个成员函数指针的可调用对象
+    static constexpr size_t InlineSize = 2 * sizeof(void*);
 
-    virtual RT Invoke(Args... args) = 0;
-};
+    template <typename Callable>
+    static constexpr bool bStoredInline =
+        sizeof(Callable) <= InlineSize && alignof(Callable) <= alignof(void*) &&
+        std::is_nothrow_move_constructible_v<Callable>;
 
-template <typename Callable, typename RT, typename... Args>
-    requires std::is_invocable_r_v<RT, Callable, Args...>
-struct MemberFuncWrapper_Impl : MemberFuncWrapper_Base<RT, Args...>
-{
-    explicit MemberFuncWrapper_Impl(Callable&& obj) : CallableObj(std::forward<Callable>(obj))
-    {}
+    MemberFuncWrapper() = default;
 
-    RT Invoke(Args... args) override
+    template <typename Callable>
+        requires std::is_invocable_r_v<RT, const Callable&, Args...> && std::is_copy_constructible_v<Callable>
+    explicit MemberFuncWrapper(Callable func)
     {
-        return CallableObj(std::forward<Args>(args)...);
+        Emplace(std::move(func));
     }
 
-private:
-    Callable CallableObj;
-};
+    MemberFuncWrapper(const MemberFuncWrapper& Other)
+    {
+        CopyFrom(Other);
+    }
 
-template <typename T>
-struct MemberFuncWrapper;
+    MemberFuncWrapper(MemberFuncWrapper&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
 
-template <typename RT, typename... Args>
-struct MemberFuncWrapper<RT(Args...)>
-{
-    MemberFuncWrapper() = default;
+    ~MemberFuncWrapper()
+    {
+        Reset();
+    }
 
-    template <typename Callable>
-        requires std::is_invocable_r_v<RT, Callable, Args...>
-    explicit MemberFuncWrapper(Callable func)
-        : Wrapper(std::make_unique<MemberFuncWrapper_Impl<Callable, RT, Args...>>(std::move(func)))
-    {}
+    MemberFuncWrapper& operator=(const MemberFuncWrapper& Other)
+    {
+        if (this != &Other)
+        {
+            Reset();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    MemberFuncWrapper& operator=(MemberFuncWrapper&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
 
     template <typename Callable>
-        requires std::is_invocable_r_v<RT, Callable, Args...>
+        requires std::is_invocable_r_v<RT, const Callable&, Args...> && std::is_copy_constructible_v<Callable>
     MemberFuncWrapper& operator=(Callable func)
     {
-        Wrapper = std::make_unique<MemberFuncWrapper_Impl<Callable, RT, Args...>>(std::move(func));
+        Reset();
+        Emplace(std::move(func));
         return *this;
     }
 
-    RT Invoke(Args... args)
+    RT Invoke(Args... args) const
+    {
+        return Trampoline(GetCallable(), std::forward<Args>(args)...);
+    }
+
+    // 包装的可调用对象的地址，内联保存时位于包装器内部，复制后的包装器返回各自的地址
+    const void* GetCallable() const
+    {
+        if (Manager == nullptr)
+        {
+            return Trampoline ? static_cast<const void*>(Storage) : nullptr;
+        }
+
+        return Manager(StorageOp::GetCallable, const_cast<MemberFuncWrapper*>(this), nullptr);
+    }
+
+    explicit operator bool() const
     {
-        return Wrapper->Invoke(std::forward<Args>(args)...);
+        return Trampoline != nullptr;
     }
 
 private:
-    //@[TODO] 这里在外部使用时，指针类型无法正常支持万能引用，考虑优化
-    std::unique_ptr<MemberFuncWrapper_Base<RT, Args...>> Wrapper;
+    enum class StorageOp
+    {
+        GetCallable,
+        Copy,
+        Move,
+        Destroy
+    };
+
+    using TrampolineType = RT (*)(const void*, Args...);
+
+    // 平凡的内联可调用对象没有Manager，按字节复制且无需析构
+    using ManagerType = const void* (*)(StorageOp, MemberFuncWrapper*, MemberFuncWrapper*);
+
+    template <typename Callable>
+    static RT InvokeCallable(const void* CallableObj, Args... args)
+    {
+        return (*static_cast<const Callable*>(CallableObj))(std::forward<Args>(args)...);
+    }
+
+    template <typename Callable>
+    static const void* ManageInline(StorageOp Op, MemberFuncWrapper* Self, MemberFuncWrapper* Other)
+    {
+        auto* CallableObj = std::launder(reinterpret_cast<Callable*>(Self->Storage));
+
+        switch (Op)
+        {
+        case StorageOp::GetCallable:
+            return CallableObj;
+        case StorageOp::Copy:
+            ::new (static_cast<void*>(Other->Storage)) Callable(*CallableObj);
+            break;
+        case StorageOp::Move:
+            ::new (static_cast<void*>(Other->Storage)) Callable(std::move(*CallableObj));
+            CallableObj->~Callable();
+            break;
+        case StorageOp::Destroy:
+            CallableObj->~Callable();
+            break;
+        }
+        return nullptr;
+    }
+
+    template <typename Callable>
+    static const void* ManageHeap(StorageOp Op, MemberFuncWrapper* Self, MemberFuncWrapper* Other)
+    {
+        Callable*& CallableObj = *std::launder(reinterpret_cast<Callable**>(Self->Storage));
+
+        switch (Op)
+        {
+        case StorageOp::GetCallable:
+            return CallableObj;
+        case StorageOp::Copy:
+            ::new (static_cast<void*>(Other->Storage)) Callable*(new Callable(*CallableObj));
+            break;
+        case StorageOp::Move:
+            ::new (static_cast<void*>(Other->Storage)) Callable*(CallableObj);
+            break;
+        case StorageOp::Destroy:
+            delete CallableObj;
+            break;
+        }
+        return nullptr;
+    }
+
+    template <typename Callable>
+    void Emplace(Callable&& func)
+    {
+        using CallableType = std::decay_t<Callable>;
+
+        if constexpr (bStoredInline<CallableType>)
+        {
+            ::new (static_cast<void*>(Storage)) CallableType(std::forward<Callable>(func));
+
+            if constexpr (!std::is_trivially_copyable_v<CallableType>)
+            {
+                Manager = &ManageInline<CallableType>;
+            }
+        }
+        else
+        {
+            ::new (static_cast<void*>(Storage)) CallableType*(new CallableType(std::forward<Callable>(func)));
+            Manager = &ManageHeap<CallableType>;
+        }
+
+        Trampoline = &InvokeCallable<CallableType>;
+    }
+
+    void CopyFrom(const MemberFuncWrapper& Other)
+    {
+        if (Other.Manager != nullptr)
+        {
+            Other.Manager(StorageOp::Copy, const_cast<MemberFuncWrapper*>(&Other), this);
+        }
+        else
+        {
+            std::memcpy(Storage, Other.Storage, InlineSize);
+        }
+
+        Trampoline = Other.Trampoline;
+        Manager = Other.Manager;
+    }
+
+    void MoveFrom(MemberFuncWrapper& Other)
+    {
+        if (Other.Manager != nullptr)
+        {
+            Other.Manager(StorageOp::Move, &Other, this);
+        }
+        else
+        {
+            std::memcpy(Storage, Other.Storage, InlineSize);
+        }
+
+        Trampoline = Other.Trampoline;
+        Manager = Other.Manager;
+
+        Other.Trampoline = nullptr;
+        Other.Manager = nullptr;
+    }
+
+    void Reset()
+    {
+        if (Manager != nullptr)
+        {
+            Manager(StorageOp::Destroy, this, nullptr);
+        }
+
+        Trampoline = nullptr;
+        Manager = nullptr;
+    }
+
+private:
+    alignas(void*) unsigned char Storage[InlineSize]{};
+
+    TrampolineType Trampoline = nullptr;
+    ManagerType    Manager = nullptr;
 };
 
 
@@ -0,0 +1,140 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+// ======================================= 反射元数据内存池 ======================================= //
+namespace NekiraReflect
+{
+
+// 只析构、不释放内存的删除器，内存随内存池整体释放
+struct ArenaDeleter
+{
+    template <typename Type>
+    void operator()(Type* Object) const
+    {
+        Object->~Type();
+    }
+};
+
+// 由内存池分配的对象
+template <typename Type>
+using ArenaPtr = std::unique_ptr<Type, ArenaDeleter>;
+
+// 反射元数据的线性内存池：TypeInfo及其名称依次分配在连续的内存页中，
+// 单个对象不会单独释放，全部内存在内存池析构或Release()时一次性释放。
+class MetadataArena final
+{
+public:
+    struct Statistics
+    {
+        // 已分配给对象的字节数
+        size_t BytesUsed = 0;
+
+        // 向系统申请的内存页总字节数
+        size_t BytesReserved = 0;
+
+        // 分配次数
+        size_t AllocationCount = 0;
+
+        // 内存页数量(即向系统申请内存的次数)
+        size_t PageCount = 0;
+    };
+
+    // 默认的单页大小
+    static constexpr size_t DefaultPageSize = 64 * 1024;
+
+    // [INFO] InPageSize为0时每次分配都单独向系统申请内存，与不使用内存池时的内存布局相同(用于比较)
+    explicit MetadataArena(size_t InPageSize = DefaultPageSize) : PageSize(InPageSize)
+    {}
+
+    MetadataArena(const MetadataArena&) = delete;
+    MetadataArena& operator=(const MetadataArena&) = delete;
+
+    // 分配内存(线程安全)
+    void* Allocate(size_t Size, size_t Alignment);
+
+    // 在内存池中构造对象
+    template <typename Type, typename... Args>
+    ArenaPtr<Type> Create(Args&&... args)
+    {
+        void* Memory = Allocate(sizeof(Type), alignof(Type));
+
+        return ArenaPtr<Type>(::new (Memory) Type(std::forward<Args>(args)...));
+    }
+
+    // 在内存池中构造对象，Name复制到紧随对象之后的内存中(以'\0'结尾)，并作为第一个参数传给构造函数
+    // [INFO] 用于不保存名称指针、由this + 1取得名称的紧凑对象
+    template <typename Type, typename... Args>
+    ArenaPtr<Type> CreateWithTrailingName(std::string_view Name, Args&&... args)
+    {
+        void* Memory = Allocate(sizeof(Type) + Name.size() + 1, alignof(Type));
+
+        char* NameData = static_cast<char*>(Memory) + sizeof(Type);
+        std::memcpy(NameData, Name.data(), Name.size());
+        NameData[Name.size()] = '\0';
+
+        return ArenaPtr<Type>(::new (Memory) Type(std::string_view(NameData, Name.size()), std::forward<Args>(args)...));
+    }
+
+    // 将字符串复制到内存池中(以'\0'结尾)，返回的视图在内存池释放前有效
+    std::string_view StoreString(std::string_view String);
+
+    // 一次性释放全部内存，调用前须确保池中的对象均已析构
+    void Release();
+
+    // 获取内存使用统计
+    Statistics GetStatistics() const;
+
+    // 获取当前线程在所有内存池中的累计分配统计(仅BytesUsed与AllocationCount有效)
+    // 用于统计某段代码创建的元数据，不受其他线程并发分配的干扰
+    static Statistics GetThreadStatistics();
+
+private:
+    // 单页大小，超过其四分之一的分配使用独立的内存页
+    size_t PageSize;
+
+    // 当前页的剩余空间
+    std::byte* Cursor = nullptr;
+    std::byte* PageEnd = nullptr;
+
+    std::vector<std::unique_ptr<std::byte[]>> Pages;
+
+    Statistics Stats;
+
+    mutable std::mutex Mutex;
+};
+
+} // namespace NekiraReflect
@@ -0,0 +1,149 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+// ======================================= 稳定的64位哈希 ======================================= //
+namespace NekiraReflect
+{
+
+// XXH64的常量与单轮运算
+namespace StableHashDetail
+{
+
+inline constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+inline constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+inline constexpr uint64_t Prime3 = 0x165667B19E3779F9ULL;
+inline constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+inline constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+inline constexpr uint64_t RotateLeft(uint64_t Value, int Bits)
+{
+    return (Value << Bits) | (Value >> (64 - Bits));
+}
+
+inline uint64_t Read64(const unsigned char* Data)
+{
+    uint64_t Value;
+    std::memcpy(&Value, Data, sizeof(Value));
+    return Value;
+}
+
+inline uint32_t Read32(const unsigned char* Data)
+{
+    uint32_t Value;
+    std::memcpy(&Value, Data, sizeof(Value));
+    return Value;
+}
+
+inline uint64_t Round(uint64_t Accumulator, uint64_t Input)
+{
+    Accumulator += Input * Prime2;
+    Accumulator = RotateLeft(Accumulator, 31);
+    return Accumulator * Prime1;
+}
+
+inline uint64_t MergeRound(uint64_t Accumulator, uint64_t Value)
+{
+    Accumulator ^= Round(0, Value);
+    return Accumulator * Prime1 + Prime4;
+}
+
+} // namespace StableHashDetail
+
+// 计算字节序列的XXH64哈希，结果只取决于字节内容与Seed，不随进程或运行次数变化
+// [INFO] 按主机字节序读取，不同字节序的平台结果不同
+inline uint64_t HashBytes(const void* Data, size_t Size, uint64_t Seed = 0)
+{
+    using namespace StableHashDetail;
+
+    const auto* Bytes = static_cast<const unsigned char*>(Data);
+    const auto* End = Bytes + Size;
+
+    uint64_t Result;
+
+    if (Size >= 32)
+    {
+        uint64_t Lane1 = Seed + Prime1 + Prime2;
+        uint64_t Lane2 = Seed + Prime2;
+        uint64_t Lane3 = Seed;
+        uint64_t Lane4 = Seed - Prime1;
+
+        // 4条独立的通道，每次处理32字节
+        for (; Bytes + 32 <= End; Bytes += 32)
+        {
+            Lane1 = Round(Lane1, Read64(Bytes));
+            Lane2 = Round(Lane2, Read64(Bytes + 8));
+            Lane3 = Round(Lane3, Read64(Bytes + 16));
+            Lane4 = Round(Lane4, Read64(Bytes + 24));
+        }
+
+        Result = RotateLeft(Lane1, 1) + RotateLeft(Lane2, 7) + RotateLeft(Lane3, 12) + RotateLeft(Lane4, 18);
+        Result = MergeRound(Result, Lane1);
+        Result = MergeRound(Result, Lane2);
+        Result = MergeRound(Result, Lane3);
+        Result = MergeRound(Result, Lane4);
+    }
+    else
+    {
+        Result = Seed + Prime5;
+    }
+
+    Result += static_cast<uint64_t>(Size);
+
+    for (; Bytes + 8 <= End; Bytes += 8)
+    {
+        Result ^= Round(0, Read64(Bytes));
+        Result = RotateLeft(Result, 27) * Prime1 + Prime4;
+    }
+
+    if (Bytes + 4 <= End)
+    {
+        Result ^= static_cast<uint64_t>(Read32(Bytes)) * Prime1;
+        Result = RotateLeft(Result, 23) * Prime2 + Prime3;
+        Bytes += 4;
+    }
+
+    for (; Bytes < End; ++Bytes)
+    {
+        Result ^= static_cast<uint64_t>(*Bytes) * Prime5;
+        Result = RotateLeft(Result, 11) * Prime1;
+    }
+
+    // 雪崩
+    Result ^= Result >> 33;
+    Result *= Prime2;
+    Result ^= Result >> 29;
+    Result *= Prime3;
+    Result ^= Result >> 32;
+
+    return Result;
+}
+
+} // namespace NekiraReflect
@@ -0,0 +1,75 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <typeindex>
+
+
+// ======================================= 类型ID ======================================= //
+namespace NekiraReflect
+{
+
+// 进程内唯一且连续分配的类型ID，可直接作为数组下标，0 表示无效
+using TypeId = uint32_t;
+
+inline constexpr TypeId InvalidTypeId = 0;
+
+// 获取std::type_index对应的TypeId，首次查询时分配(线程安全)
+TypeId GetOrCreateTypeId(std::type_index TypeIndex);
+
+// 查找std::type_index已分配的TypeId，尚未分配时返回InvalidTypeId且不分配(线程安全)
+TypeId FindTypeId(std::type_index TypeIndex);
+
+// 获取TypeId对应的std::type_index，TypeId无效时返回typeid(void)
+std::type_index GetTypeIndexById(TypeId Id);
+
+// 解除TypeId与std::type_index的绑定，之后GetTypeIndexById(Id)返回typeid(void)
+// 卸载模块前调用，避免分配表继续引用模块内的std::type_info。
+// TypeId不会分配给其他类型，同一个std::type_info再次出现时(如模块重新加载到相同地址)会重新绑定到该TypeId
+void UnbindTypeId(TypeId Id);
+
+// 定义NEKIRA_REFLECT_CHECKED_ACCESS时，未标明Unchecked的成员访问都会校验TypeId(用于测试构建)
+#ifdef NEKIRA_REFLECT_CHECKED_ACCESS
+inline constexpr bool bCheckedMemberAccess = true;
+#else
+inline constexpr bool bCheckedMemberAccess = false;
+#endif
+
+// 输出访问的类型与成员的类型不一致的错误并终止程序，由校验的成员访问调用
+[[noreturn]] void ReportTypeMismatch(std::string_view MemberName, TypeId Expected, TypeId Actual);
+
+// 获取类型的TypeId，结果缓存在函数内的静态变量中，之后的调用不再查表
+// [INFO] 与std::type_index一致，忽略顶层的const/volatile与引用
+template <typename Type>
+TypeId TypeIdOf()
+{
+    static const TypeId Id = GetOrCreateTypeId(std::type_index(typeid(Type)));
+    return Id;
+}
+
+} // namespace NekiraReflect
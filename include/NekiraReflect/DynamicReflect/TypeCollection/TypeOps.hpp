@@ -0,0 +1,287 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/TypeCollection/StableHash.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+
+// ======================================= 类型操作表 ======================================= //
+namespace NekiraReflect
+{
+
+// 按类型生成的操作表，使运行时只持有void*的反射代码也能正确地复制、哈希与比较成员
+// [INFO] 操作表是所在模块中的静态对象，与引用它的成员信息来自同一个模块，模块卸载时一并失效
+struct TypeOps
+{
+    // sizeof(Type)
+    uint32_t Size = 0;
+
+    // 可按字节复制的类型由调用方合并为memcpy，不经过Copy
+    bool bTriviallyCopyable = false;
+
+    // 值相等当且仅当字节相等的类型(无填充、非浮点、非指针)由调用方合并为按字节哈希与比较，不经过Hash与Equals
+    bool bUniqueBytes = false;
+
+    // 复制赋值 *Dst = *Src，类型不可复制时为nullptr
+    void (*Copy)(void* Dst, const void* Src) = nullptr;
+
+    // 以Seed为初值计算稳定的64位哈希，类型不可哈希时为nullptr
+    uint64_t (*Hash)(const void* Value, uint64_t Seed) = nullptr;
+
+    // 与Hash一致的相等比较(相等的值哈希相同)，类型不可哈希时为nullptr
+    bool (*Equals)(const void* Lhs, const void* Rhs) = nullptr;
+};
+
+template <typename Type>
+void TypeOps_CopyValue(void* Dst, const void* Src)
+{
+    if constexpr (std::is_array_v<Type>)
+    {
+        // 多维数组按元素逐个复制
+        using ElementType = std::remove_all_extents_t<Type>;
+
+        const auto* SrcElements = reinterpret_cast<const ElementType*>(Src);
+        std::copy(SrcElements, SrcElements + sizeof(Type) / sizeof(ElementType), reinterpret_cast<ElementType*>(Dst));
+    }
+    else
+    {
+        *static_cast<Type*>(Dst) = *static_cast<const Type*>(Src);
+    }
+}
+
+template <typename Type>
+constexpr bool TypeOps_IsCopyable()
+{
+    if constexpr (std::is_array_v<Type>)
+    {
+        return std::is_copy_assignable_v<std::remove_all_extents_t<Type>>;
+    }
+    else
+    {
+        return std::is_copy_assignable_v<Type>;
+    }
+}
+
+// 值与字节一一对应的类型，可直接按字节哈希与比较
+// [INFO] 指针虽然满足std::has_unique_object_representations，但地址在每次运行时都不同，不按字节处理
+template <typename Type>
+constexpr bool TypeOps_IsUniqueBytes()
+{
+    using ElementType = std::remove_all_extents_t<Type>;
+
+    return std::has_unique_object_representations_v<Type> && !std::is_pointer_v<ElementType> &&
+           !std::is_member_pointer_v<ElementType>;
+}
+
+// 值与字节一一对应的类型按字节哈希与比较；浮点数按值哈希与比较(-0.0与0.0相等，NaN与NaN相等)；
+// 指针按地址哈希与比较，哈希不跨运行稳定；
+// 有序的容器(如std::string、std::vector)与数组按长度与元素依次哈希，无序容器的遍历顺序不稳定，不可哈希；
+// 成员指针与含填充字节的结构体不可哈希
+template <typename Type>
+constexpr bool TypeOps_IsHashable()
+{
+    if constexpr (TypeOps_IsUniqueBytes<Type>() || std::is_floating_point_v<Type> || std::is_pointer_v<Type>)
+    {
+        return true;
+    }
+    else if constexpr (std::is_member_pointer_v<Type> || std::is_null_pointer_v<Type>)
+    {
+        return false;
+    }
+    else if constexpr (std::ranges::sized_range<const Type> && !requires { typename Type::hasher; })
+    {
+        using ElementType = std::ranges::range_value_t<const Type>;
+
+        // 排除元素类型与自身相同的范围(如std::filesystem::path)
+        if constexpr (std::is_same_v<std::remove_cv_t<ElementType>, Type>)
+        {
+            return false;
+        }
+        else
+        {
+            return TypeOps_IsHashable<ElementType>();
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+// 元素可按字节处理的连续范围，整段数据一次哈希或比较
+template <typename Type>
+constexpr bool TypeOps_IsContiguousBytes()
+{
+    if constexpr (std::ranges::contiguous_range<const Type>)
+    {
+        return TypeOps_IsUniqueBytes<std::ranges::range_value_t<const Type>>();
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename Type>
+uint64_t TypeOps_HashValue(const void* Value, uint64_t Seed)
+{
+    if constexpr (TypeOps_IsUniqueBytes<Type>())
+    {
+        return HashBytes(Value, sizeof(Type), Seed);
+    }
+    else if constexpr (std::is_floating_point_v<Type>)
+    {
+        // 统一转为double再哈希：-0.0归为0.0，NaN归为同一个值，long double的填充字节不参与哈希
+        double Normalized = static_cast<double>(*static_cast<const Type*>(Value));
+
+        if (Normalized == 0.0)
+        {
+            Normalized = 0.0;
+        }
+        else if (std::isnan(Normalized))
+        {
+            Normalized = std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return HashBytes(&Normalized, sizeof(Normalized), Seed);
+    }
+    else if constexpr (std::is_pointer_v<Type>)
+    {
+        const auto Address = reinterpret_cast<uintptr_t>(*static_cast<const Type*>(Value));
+        return HashBytes(&Address, sizeof(Address), Seed);
+    }
+    else
+    {
+        using ElementType = std::ranges::range_value_t<const Type>;
+
+        const Type&    Object = *static_cast<const Type*>(Value);
+        const uint64_t Count = static_cast<uint64_t>(std::ranges::size(Object));
+
+        // 先哈希长度，使{"ab", "c"}与{"a", "bc"}的哈希不同
+        uint64_t Result = HashBytes(&Count, sizeof(Count), Seed);
+
+        if constexpr (TypeOps_IsContiguousBytes<Type>())
+        {
+            return Count == 0 ? Result : HashBytes(std::ranges::data(Object), Count * sizeof(ElementType), Result);
+        }
+        else
+        {
+            for (const ElementType& Element : Object)
+            {
+                Result = TypeOps_HashValue<ElementType>(std::addressof(Element), Result);
+            }
+
+            return Result;
+        }
+    }
+}
+
+template <typename Type>
+bool TypeOps_EqualsValue(const void* Lhs, const void* Rhs)
+{
+    if constexpr (TypeOps_IsUniqueBytes<Type>())
+    {
+        return std::memcmp(Lhs, Rhs, sizeof(Type)) == 0;
+    }
+    else if constexpr (std::is_floating_point_v<Type>)
+    {
+        // 与Hash一致：NaN与NaN相等
+        const Type LhsValue = *static_cast<const Type*>(Lhs);
+        const Type RhsValue = *static_cast<const Type*>(Rhs);
+
+        return LhsValue == RhsValue || (std::isnan(LhsValue) && std::isnan(RhsValue));
+    }
+    else if constexpr (std::is_pointer_v<Type>)
+    {
+        return *static_cast<const Type*>(Lhs) == *static_cast<const Type*>(Rhs);
+    }
+    else
+    {
+        using ElementType = std::ranges::range_value_t<const Type>;
+
+        const Type& LhsObject = *static_cast<const Type*>(Lhs);
+        const Type& RhsObject = *static_cast<const Type*>(Rhs);
+        const auto  Count = std::ranges::size(LhsObject);
+
+        if (Count != std::ranges::size(RhsObject))
+        {
+            return false;
+        }
+
+        if constexpr (TypeOps_IsContiguousBytes<Type>())
+        {
+            return Count == 0 ||
+                   std::memcmp(std::ranges::data(LhsObject), std::ranges::data(RhsObject), Count * sizeof(ElementType)) == 0;
+        }
+        else
+        {
+            return std::ranges::equal(LhsObject, RhsObject, [](const ElementType& Left, const ElementType& Right) {
+                return TypeOps_EqualsValue<ElementType>(std::addressof(Left), std::addressof(Right));
+            });
+        }
+    }
+}
+
+template <typename Type>
+constexpr TypeOps TypeOps_Make()
+{
+    TypeOps Result;
+    Result.Size = static_cast<uint32_t>(sizeof(Type));
+    Result.bTriviallyCopyable = std::is_trivially_copyable_v<Type> && !std::is_const_v<std::remove_all_extents_t<Type>>;
+    Result.bUniqueBytes = TypeOps_IsUniqueBytes<Type>();
+
+    if constexpr (TypeOps_IsCopyable<Type>())
+    {
+        Result.Copy = &TypeOps_CopyValue<Type>;
+    }
+
+    if constexpr (TypeOps_IsHashable<Type>())
+    {
+        Result.Hash = &TypeOps_HashValue<Type>;
+        Result.Equals = &TypeOps_EqualsValue<Type>;
+    }
+
+    return Result;
+}
+
+template <typename Type>
+inline constexpr TypeOps TypeOps_Instance = TypeOps_Make<Type>();
+
+// Get the operation table of Type(const类型不可复制)
+template <typename Type>
+const TypeOps* GetTypeOps()
+{
+    return &TypeOps_Instance<Type>;
+}
+
+} // namespace NekiraReflect
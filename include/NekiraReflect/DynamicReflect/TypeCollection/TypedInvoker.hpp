@@ -0,0 +1,119 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraReflect/DynamicReflect/TypeCollection/CoreType.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+// ======================================= 类型化的成员函数调用器 ======================================= //
+namespace NekiraReflect
+{
+
+template <typename Signature>
+class TypedInvoker;
+
+// 预先校验签名的成员函数调用器，调用时经一次间接调用直接执行成员函数，不经过std::any与参数帧
+// [INFO] Signature须与成员函数的签名RT(Args...)完全一致；解析失败时调用器无效，对无效调用器调用是未定义行为
+// [INFO] 调用器引用成员函数信息持有的可调用对象，所在模块卸载后不能再使用
+// @example:
+// TypedInvoker<int(float, const std::string&)> Compute(GetNClass<Nekira::Test::SampleClass>(), "Compute");
+// if (Compute)
+// {
+//     int Result = Compute(&Object, 1.0f, Name);
+// }
+template <typename RT, typename... Args>
+class TypedInvoker<RT(Args...)> final
+{
+public:
+    using DirectCallType = RT (*)(const void*, void*, Args...);
+
+    TypedInvoker() = default;
+
+    explicit TypedInvoker(const MemberFuncInfo* funcInfo)
+    {
+        if (funcInfo == nullptr)
+        {
+            return;
+        }
+
+        if (funcInfo->GetSignatureId() != TypeIdOf<RT(Args...)>())
+        {
+            std::cerr << "[NekiraReflect] TypedInvoker signature mismatch for member function " << funcInfo->GetName()
+                      << ".\n";
+            return;
+        }
+
+        Call = reinterpret_cast<DirectCallType>(funcInfo->GetDirectCall());
+        Callable = funcInfo->GetCallable();
+        ObjectOffset = funcInfo->GetObjectOffset();
+    }
+
+    TypedInvoker(const ClassTypeInfo* classInfo, std::string_view name)
+        : TypedInvoker(classInfo ? classInfo->GetFunction(name) : nullptr)
+    {}
+
+    // Whether the invoker has been resolved
+    inline bool IsValid() const
+    {
+        return Call != nullptr;
+    }
+
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    // Invoke Function
+    inline RT operator()(void* Object, Args... args) const
+    {
+        return Call(Callable, static_cast<char*>(Object) + ObjectOffset, std::forward<Args>(args)...);
+    }
+
+    // 原始的调用入口，(*this)(Object, args...)等价于GetDirectCall()(GetCallable(), Object + GetObjectOffset(), args...)
+    inline DirectCallType GetDirectCall() const
+    {
+        return Call;
+    }
+
+    inline const void* GetCallable() const
+    {
+        return Callable;
+    }
+
+    inline size_t GetObjectOffset() const
+    {
+        return ObjectOffset;
+    }
+
+private:
+    DirectCallType Call = nullptr;
+    const void*    Callable = nullptr;
+    size_t         ObjectOffset = 0;
+};
+
+} // namespace NekiraReflect
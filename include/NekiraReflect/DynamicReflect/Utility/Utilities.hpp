@@ -26,6 +26,8 @@
 #pragma once
 
 #include <NekiraReflect/DynamicReflect/TypeCollection/CoreType.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/FieldHandle.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/TypedInvoker.hpp>
 
 
 
@@ -39,6 +41,9 @@ static std::type_index GetTypeIndex()
 {
     return std::type_index(typeid(T));
 }
+
+// Get the arena that owns all registered reflection metadata
+MetadataArena& GetMetadataArena();
 } // namespace NekiraReflect
 
 
@@ -46,30 +51,36 @@ namespace NekiraReflect
 {
 // Create Enum TypeInfo
 template <typename EnumType>
-static std::unique_ptr<EnumTypeInfo> MakeEnumTypeInfo(const std::string& Name)
+static ArenaPtr<EnumTypeInfo> MakeEnumTypeInfo(std::string_view Name)
 {
     auto TypeIndex = GetTypeIndex<EnumType>();
 
     const size_t TypeSize = sizeof(EnumType);
 
-    auto EnumInfo = std::make_unique<EnumTypeInfo>(Name, TypeIndex);
+    auto& Arena = GetMetadataArena();
+
+    auto EnumInfo = Arena.Create<EnumTypeInfo>(Arena.StoreString(Name), TypeIndex);
 
     EnumInfo->SetSize(TypeSize);
+    EnumInfo->SetTypeId(TypeIdOf<EnumType>());
 
     return EnumInfo;
 }
 
 // Create Enum TypeInfo with Enum Pairs
 template <typename EnumType>
-static std::unique_ptr<EnumTypeInfo> MakeEnumTypeInfo(const std::string& Name, const EnumValuesMap& Pairs)
+static ArenaPtr<EnumTypeInfo> MakeEnumTypeInfo(std::string_view Name, const EnumValuesMap& Pairs)
 {
     auto TypeIndex = GetTypeIndex<EnumType>();
 
     const size_t TypeSize = sizeof(EnumType);
 
-    auto EnumInfo = std::make_unique<EnumTypeInfo>(Name, TypeIndex);
+    auto& Arena = GetMetadataArena();
+
+    auto EnumInfo = Arena.Create<EnumTypeInfo>(Arena.StoreString(Name), TypeIndex);
 
     EnumInfo->SetSize(TypeSize);
+    EnumInfo->SetTypeId(TypeIdOf<EnumType>());
 
     for (const auto& [name, value] : Pairs)
     {
@@ -87,24 +98,48 @@ namespace NekiraReflect
 {
 // Create Member Varaible TypeInfo
 template <typename ClassType, typename VarType>
-static std::unique_ptr<MemberVarInfo> MakeMemberVarInfo(const std::string& Name, VarType ClassType::* MemberVarPtr)
+static ArenaPtr<MemberVarInfo> MakeMemberVarInfo(std::string_view Name, VarType ClassType::* MemberVarPtr)
 {
-    return std::make_unique<MemberVarInfo>(Name, MemberVarPtr);
+    auto& Arena = GetMetadataArena();
+
+    return Arena.CreateWithTrailingName<MemberVarInfo>(Name, MemberVarPtr);
 }
 
 // Create Member Function TypeInfo
 template <typename ClassType, typename RT, typename... Args>
-static std::unique_ptr<MemberFuncInfo> MakeMemberFuncInfo(const std::string& Name, RT (ClassType::*FuncPtr)(Args...))
+static ArenaPtr<MemberFuncInfo> MakeMemberFuncInfo(std::string_view Name, RT (ClassType::*FuncPtr)(Args...))
 {
-    return std::make_unique<MemberFuncInfo>(Name, FuncPtr);
+    auto& Arena = GetMetadataArena();
+
+    return Arena.Create<MemberFuncInfo>(Arena.StoreString(Name), FuncPtr);
 }
 
 // Create Member Function TypeInfo(const)
 template <typename ClassType, typename RT, typename... Args>
-static std::unique_ptr<MemberFuncInfo> MakeMemberFuncInfo(const std::string& Name,
-                                                          RT (ClassType::*FuncPtr)(Args...) const)
+static ArenaPtr<MemberFuncInfo> MakeMemberFuncInfo(std::string_view Name, RT (ClassType::*FuncPtr)(Args...) const)
+{
+    auto& Arena = GetMetadataArena();
+
+    return Arena.Create<MemberFuncInfo>(Arena.StoreString(Name), FuncPtr);
+}
+
+// Create Base Class Info
+template <typename ClassType, typename BaseType>
+static BaseClassInfo MakeBaseClassInfo()
 {
-    return std::make_unique<MemberFuncInfo>(Name, FuncPtr);
+    static_assert(std::is_base_of_v<BaseType, ClassType>, "BaseType must be a base class of ClassType");
+
+    // 空指针的转换不做调整，因此使用一个非空且对齐的假地址计算调整量
+    constexpr uintptr_t FakeAddress = 0x10000;
+
+    auto* Derived = reinterpret_cast<ClassType*>(FakeAddress);
+    auto* Base = static_cast<BaseType*>(Derived);
+
+    BaseClassInfo Result;
+    Result.Id = TypeIdOf<BaseType>();
+    Result.Offset = static_cast<size_t>(reinterpret_cast<uintptr_t>(Base) - FakeAddress);
+
+    return Result;
 }
 
 } // namespace NekiraReflect
@@ -116,14 +151,17 @@ namespace NekiraReflect
 
 // Create Class TypeInfo
 template <typename ClassType>
-static std::unique_ptr<ClassTypeInfo> MakeClassTypeInfo(const std::string& Name)
+static ArenaPtr<ClassTypeInfo> MakeClassTypeInfo(std::string_view Name)
 {
     auto         TypeIndex = GetTypeIndex<ClassType>();
     const size_t TypeSize = sizeof(ClassType);
 
-    auto ClassInfo = std::make_unique<ClassTypeInfo>(Name, TypeIndex);
+    auto& Arena = GetMetadataArena();
+
+    auto ClassInfo = Arena.Create<ClassTypeInfo>(Arena.StoreString(Name), TypeIndex);
 
     ClassInfo->SetSize(TypeSize);
+    ClassInfo->SetTypeId(TypeIdOf<ClassType>());
 
     return ClassInfo;
 }
@@ -136,10 +174,32 @@ namespace NekiraReflect
 {
 
 // Register Enum TypeInfo
-void RegisterEnumInfo(std::unique_ptr<EnumTypeInfo> EnumInfo);
+void RegisterEnumInfo(ArenaPtr<EnumTypeInfo> EnumInfo);
 
 // Register Class TypeInfo
-void RegisterClassInfo(std::unique_ptr<ClassTypeInfo> ClassInfo);
+void RegisterClassInfo(ArenaPtr<ClassTypeInfo> ClassInfo);
+
+// Get the registry generation, it changes whenever a TypeInfo is registered, replaced or removed
+uint64_t GetRegistryGeneration();
+
+// 当前线程的查找缓存命中统计，GetNClass / GetNEnum / GetNStruct的每次调用计入一次
+struct LookupCacheStats
+{
+    uint64_t Hits = 0;
+    uint64_t Misses = 0;
+};
+
+// Get the lookup cache statistics of the calling thread
+LookupCacheStats GetLookupCacheStats();
+
+// Reset the lookup cache statistics of the calling thread
+void ResetLookupCacheStats();
+
+// Register Enum TypeInfo lazily, Register() is called the first time the enum is looked up
+void RegisterLazyEnumInfo(std::type_index TypeIndex, std::string_view Name, void (*Register)());
+
+// Register Class TypeInfo lazily, Register() is called the first time the class is looked up
+void RegisterLazyClassInfo(std::type_index TypeIndex, std::string_view Name, void (*Register)());
 
 } // namespace NekiraReflect
 
@@ -162,6 +222,11 @@ namespace NekiraReflect
 // GetNEnum( GetTypeIndex<Nekira::Test::SampleEnum>() );
 EnumTypeInfo* GetNEnum(std::type_index TypeIndex);
 
+// Get Enum TypeInfo by TypeId(array lookup, no hashing)
+// @example:
+// GetNEnum( TypeIdOf<Nekira::Test::SampleEnum>() );
+EnumTypeInfo* GetNEnum(TypeId Id);
+
 } // namespace NekiraReflect
 
 
@@ -182,8 +247,7 @@ namespace NekiraReflect
 template <typename EnumType>
 static EnumTypeInfo* GetNEnum()
 {
-    auto TypeIndex = GetTypeIndex<EnumType>();
-    return GetNEnum(TypeIndex);
+    return GetNEnum(TypeIdOf<EnumType>());
 }
 
 } // namespace NekiraReflect
@@ -209,6 +273,11 @@ namespace NekiraReflect
 // GetNClass( GetTypeIndex<Nekira::Test::SampleClass>() );
 ClassTypeInfo* GetNClass(std::type_index TypeIndex);
 
+// Get Class TypeInfo by TypeId(array lookup, no hashing)
+// @example:
+// GetNClass( TypeIdOf<Nekira::Test::SampleClass>() );
+ClassTypeInfo* GetNClass(TypeId Id);
+
 } // namespace NekiraReflect
 
 
@@ -231,8 +300,73 @@ namespace NekiraReflect
 template <typename ClassType>
 static ClassTypeInfo* GetNClass()
 {
-    auto TypeIndex = GetTypeIndex<ClassType>();
-    return GetNClass(TypeIndex);
+    return GetNClass(TypeIdOf<ClassType>());
+}
+
+} // namespace NekiraReflect
+
+
+namespace NekiraReflect
+{
+// 缓存某个类的ClassTypeInfo，首次访问时查询，之后只比较注册表的Generation即返回缓存的指针。
+// 类被替换或移除(包括卸载模块)后会自动重新查询。
+// [INFO] 非线程安全，每个线程应各自持有(例如thread_local或局部变量)
+// @example:
+// static thread_local CachedClassInfo<Nekira::Test::SampleClass> SampleInfo;
+// SampleInfo->GetVariable("Value");
+template <typename ClassType>
+class CachedClassInfo final
+{
+public:
+    ClassTypeInfo* Get()
+    {
+        const uint64_t Current = GetRegistryGeneration();
+
+        if (Info == nullptr || Generation != Current)
+        {
+            Info = GetNClass(TypeIdOf<ClassType>());
+            Generation = Current;
+        }
+
+        return Info;
+    }
+
+    ClassTypeInfo* operator->()
+    {
+        return Get();
+    }
+
+    explicit operator bool()
+    {
+        return Get() != nullptr;
+    }
+
+private:
+    ClassTypeInfo* Info = nullptr;
+    uint64_t       Generation = 0;
+};
+
+} // namespace NekiraReflect
+
+
+namespace NekiraReflect
+{
+// Resolve a FieldHandle by Class Type and member name
+// @example:
+// auto ValueField = MakeFieldHandle<int, Nekira::Test::SampleClass>("Value");
+template <typename VarType, typename ClassType>
+static FieldHandle<VarType> MakeFieldHandle(std::string_view Name)
+{
+    return FieldHandle<VarType>(GetNClass<ClassType>(), Name);
+}
+
+// Resolve a TypedInvoker by Class Type and member function name
+// @example:
+// auto Compute = MakeTypedInvoker<int(float, const std::string&), Nekira::Test::SampleClass>("Compute");
+template <typename Signature, typename ClassType>
+static TypedInvoker<Signature> MakeTypedInvoker(std::string_view Name)
+{
+    return TypedInvoker<Signature>(GetNClass<ClassType>(), Name);
 }
 
 } // namespace NekiraReflect
@@ -258,6 +392,11 @@ namespace NekiraReflect
 // GetNStruct( GetTypeIndex<Nekira::Test::SampleStruct>() );
 ClassTypeInfo* GetNStruct(std::type_index TypeIndex);
 
+// Get Struct TypeInfo by TypeId(array lookup, no hashing)
+// @example:
+// GetNStruct( TypeIdOf<Nekira::Test::SampleStruct>() );
+ClassTypeInfo* GetNStruct(TypeId Id);
+
 } // namespace NekiraReflect
 
 
@@ -280,8 +419,7 @@ namespace NekiraReflect
 template <typename StructType>
 static ClassTypeInfo* GetNStruct()
 {
-    auto TypeIndex = GetTypeIndex<StructType>();
-    return GetNStruct(TypeIndex);
+    return GetNStruct(TypeIdOf<StructType>());
 }
 
 } // namespace NekiraReflect
\ No newline at end of file
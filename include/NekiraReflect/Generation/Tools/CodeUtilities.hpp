@@ -101,6 +101,9 @@ private:
     // 处理成员函数的声明
     static void ProcessMemberFuncDecl(const CXCursor& Cursor, ClassMetaInfo* ClassMeta);
 
+    // 处理基类声明
+    static void ProcessBaseSpecifier(const CXCursor& Cursor, ClassMetaInfo* ClassMeta);
+
     // 成员访问回调(用于类和结构体)
     static CXChildVisitResult MemberVisitor(CXCursor Cursor, CXCursor Root, CXClientData ClientData);
 
@@ -77,10 +77,16 @@ struct ClassMetaInfo
     // 类的限定名称(包含命名空间),若无命名空间则等同于Name,否则相当于 NameSpace::Name
     std::string QualifiedName;
 
+    // 公有、非虚基类的限定名称，按声明顺序排列
+    std::vector<std::string> BaseClasses;
+
     // 类的成员变量
     std::vector<MemberVarMetaInfo> MemberVars;
 
     // 类的成员函数
     std::vector<MemberFuncMetaInfo> MemberFuncs;
+
+    // 标注NDIRTYFIELDS()的DirtyFieldSet成员的名称，为空时不追踪脏成员
+    std::string DirtySetName;
 };
 } // namespace NekiraReflect
\ No newline at end of file
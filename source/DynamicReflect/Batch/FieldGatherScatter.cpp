@@ -0,0 +1,905 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Batch/FieldGatherScatter.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define NEKIRA_REFLECT_BATCH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define NEKIRA_REFLECT_BATCH_X86 0
+#endif
+
+// MSVC无需为单个函数启用指令集
+#if NEKIRA_REFLECT_BATCH_X86 && (defined(__GNUC__) || defined(__clang__))
+#define NEKIRA_REFLECT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define NEKIRA_REFLECT_TARGET_AVX2
+#endif
+
+
+namespace NekiraReflect
+{
+
+namespace
+{
+
+// 检测CPU(及操作系统)是否支持AVX2
+BatchInstructionSet DetectInstructionSet()
+{
+#if NEKIRA_REFLECT_BATCH_X86
+#if defined(_MSC_VER)
+    int Info[4] = {};
+    __cpuid(Info, 1);
+
+    // OSXSAVE与AVX，且操作系统保存YMM寄存器
+    const bool bOSSupportsAVX = (Info[2] & (1 << 27)) != 0 && (Info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+    __cpuidex(Info, 7, 0);
+
+    if (bOSSupportsAVX && (Info[1] & (1 << 5)) != 0)
+    {
+        return BatchInstructionSet::AVX2;
+    }
+#else
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return BatchInstructionSet::AVX2;
+    }
+#endif
+#endif
+
+    return BatchInstructionSet::Scalar;
+}
+
+const BatchInstructionSet SupportedInstructionSet = DetectInstructionSet();
+
+std::atomic<BatchInstructionSet> ActiveInstructionSet{SupportedInstructionSet};
+
+inline bool IsAVX2Active()
+{
+    return ActiveInstructionSet.load(std::memory_order_relaxed) == BatchInstructionSet::AVX2;
+}
+
+// 固定大小的逐元素复制，编译器可将memcpy展开为单条加载与存储
+template <size_t Size>
+void GatherScalar(const char* Src, size_t Stride, size_t Count, char* Dense)
+{
+    for (size_t Index = 0; Index < Count; ++Index, Src += Stride)
+    {
+        std::memcpy(Dense + Index * Size, Src, Size);
+    }
+}
+
+template <size_t Size>
+void ScatterScalar(char* Dst, size_t Stride, size_t Count, const char* Dense)
+{
+    for (size_t Index = 0; Index < Count; ++Index, Dst += Stride)
+    {
+        std::memcpy(Dst, Dense + Index * Size, Size);
+    }
+}
+
+void GatherBytes(const char* Src, size_t Stride, size_t Count, size_t Size, char* Dense)
+{
+    for (size_t Index = 0; Index < Count; ++Index, Src += Stride)
+    {
+        std::memcpy(Dense + Index * Size, Src, Size);
+    }
+}
+
+void ScatterBytes(char* Dst, size_t Stride, size_t Count, size_t Size, const char* Dense)
+{
+    for (size_t Index = 0; Index < Count; ++Index, Dst += Stride)
+    {
+        std::memcpy(Dst, Dense + Index * Size, Size);
+    }
+}
+
+#if NEKIRA_REFLECT_BATCH_X86
+// 每次收集8个4字节元素，下标为相对于当前基址的字节偏移
+NEKIRA_REFLECT_TARGET_AVX2 void Gather32_AVX2(const char* Src, size_t Stride, size_t Count, char* Dense)
+{
+    const int     Step = static_cast<int>(Stride);
+    const __m256i Offsets = _mm256_setr_epi32(0, Step, 2 * Step, 3 * Step, 4 * Step, 5 * Step, 6 * Step, 7 * Step);
+
+    size_t Index = 0;
+
+    for (; Index + 8 <= Count; Index += 8, Src += 8 * Stride)
+    {
+        const __m256i Values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(Src), Offsets, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dense + Index * 4), Values);
+    }
+
+    GatherScalar<4>(Src, Stride, Count - Index, Dense + Index * 4);
+}
+
+// 每次收集4个8字节元素
+NEKIRA_REFLECT_TARGET_AVX2 void Gather64_AVX2(const char* Src, size_t Stride, size_t Count, char* Dense)
+{
+    const int     Step = static_cast<int>(Stride);
+    const __m128i Offsets = _mm_setr_epi32(0, Step, 2 * Step, 3 * Step);
+
+    size_t Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4, Src += 4 * Stride)
+    {
+        const __m256i Values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(Src), Offsets, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dense + Index * 8), Values);
+    }
+
+    GatherScalar<8>(Src, Stride, Count - Index, Dense + Index * 8);
+}
+#endif
+
+// 按字节收集，根据成员大小与指令集选择实现
+void GatherTrivial(const char* Src, size_t Stride, size_t Count, size_t Size, char* Dense)
+{
+#if NEKIRA_REFLECT_BATCH_X86
+    // gather的下标为32位有符号整数，最大偏移为7个步长
+    const bool bUseAVX2 = IsAVX2Active() && Stride <= static_cast<size_t>(INT_MAX) / 8;
+
+    if (bUseAVX2 && Size == 4)
+    {
+        Gather32_AVX2(Src, Stride, Count, Dense);
+        return;
+    }
+
+    if (bUseAVX2 && Size == 8)
+    {
+        Gather64_AVX2(Src, Stride, Count, Dense);
+        return;
+    }
+#endif
+
+    switch (Size)
+    {
+    case 1:
+        GatherScalar<1>(Src, Stride, Count, Dense);
+        break;
+    case 2:
+        GatherScalar<2>(Src, Stride, Count, Dense);
+        break;
+    case 4:
+        GatherScalar<4>(Src, Stride, Count, Dense);
+        break;
+    case 8:
+        GatherScalar<8>(Src, Stride, Count, Dense);
+        break;
+    case 16:
+        GatherScalar<16>(Src, Stride, Count, Dense);
+        break;
+    default:
+        GatherBytes(Src, Stride, Count, Size, Dense);
+        break;
+    }
+}
+
+// 按字节分发
+void ScatterTrivial(char* Dst, size_t Stride, size_t Count, size_t Size, const char* Dense)
+{
+    switch (Size)
+    {
+    case 1:
+        ScatterScalar<1>(Dst, Stride, Count, Dense);
+        break;
+    case 2:
+        ScatterScalar<2>(Dst, Stride, Count, Dense);
+        break;
+    case 4:
+        ScatterScalar<4>(Dst, Stride, Count, Dense);
+        break;
+    case 8:
+        ScatterScalar<8>(Dst, Stride, Count, Dense);
+        break;
+    case 16:
+        ScatterScalar<16>(Dst, Stride, Count, Dense);
+        break;
+    default:
+        ScatterBytes(Dst, Stride, Count, Size, Dense);
+        break;
+    }
+}
+
+// 不可按字节复制的成员只能逐个复制赋值
+bool CanCopy(const MemberVarInfo* VarInfo, const char* Operation)
+{
+    if (VarInfo == nullptr)
+    {
+        return false;
+    }
+
+    const TypeOps* Ops = VarInfo->GetTypeOps();
+
+    if (!Ops->bTriviallyCopyable && Ops->Copy == nullptr)
+    {
+        std::cerr << "[NekiraReflect] " << Operation << " skips member " << VarInfo->GetName()
+                  << ", its type is not copy assignable.\n";
+        return false;
+    }
+
+    return true;
+}
+
+// 所在类启用脏成员追踪时，标记每个对象中被写入的成员
+void MarkDirtyField(const ObjectSpan& Objects, size_t Count, const MemberVarInfo* VarInfo)
+{
+    if (VarInfo->GetDirtyIndex() == MemberVarInfo::InvalidDirtyIndex)
+    {
+        return;
+    }
+
+    char* Object = static_cast<char*>(Objects.Data);
+
+    for (size_t Index = 0; Index < Count; ++Index, Object += Objects.Stride)
+    {
+        VarInfo->MarkDirty(Object);
+    }
+}
+
+// ===== 连续数组的标量归约，按4路展开 ===== //
+template <typename ValueType, typename SumType>
+SumType SumScalar(const ValueType* Values, size_t Count)
+{
+    SumType Partials[4] = {};
+    size_t  Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        Partials[0] += static_cast<SumType>(Values[Index]);
+        Partials[1] += static_cast<SumType>(Values[Index + 1]);
+        Partials[2] += static_cast<SumType>(Values[Index + 2]);
+        Partials[3] += static_cast<SumType>(Values[Index + 3]);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Partials[0] += static_cast<SumType>(Values[Index]);
+    }
+
+    return (Partials[0] + Partials[1]) + (Partials[2] + Partials[3]);
+}
+
+template <typename ValueType>
+void MinMaxScalar(const ValueType* Values, size_t Count, ValueType& Min, ValueType& Max)
+{
+    ValueType Mins[4] = {Min, Min, Min, Min};
+    ValueType Maxs[4] = {Max, Max, Max, Max};
+    size_t    Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        for (size_t Partial = 0; Partial < 4; ++Partial)
+        {
+            const ValueType Value = Values[Index + Partial];
+            Mins[Partial] = Value < Mins[Partial] ? Value : Mins[Partial];
+            Maxs[Partial] = Maxs[Partial] < Value ? Value : Maxs[Partial];
+        }
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        const ValueType Value = Values[Index];
+        Mins[0] = Value < Mins[0] ? Value : Mins[0];
+        Maxs[0] = Maxs[0] < Value ? Value : Maxs[0];
+    }
+
+    for (size_t Partial = 0; Partial < 4; ++Partial)
+    {
+        Min = Mins[Partial] < Min ? Mins[Partial] : Min;
+        Max = Max < Maxs[Partial] ? Maxs[Partial] : Max;
+    }
+}
+
+template <typename ValueType>
+size_t CountScalar(const ValueType* Values, size_t Count, ValueType Value)
+{
+    size_t Partials[4] = {};
+    size_t Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        Partials[0] += Values[Index] == Value ? 1 : 0;
+        Partials[1] += Values[Index + 1] == Value ? 1 : 0;
+        Partials[2] += Values[Index + 2] == Value ? 1 : 0;
+        Partials[3] += Values[Index + 3] == Value ? 1 : 0;
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Partials[0] += Values[Index] == Value ? 1 : 0;
+    }
+
+    return (Partials[0] + Partials[1]) + (Partials[2] + Partials[3]);
+}
+
+#if NEKIRA_REFLECT_BATCH_X86
+// ===== 连续数组的AVX2归约，剩余不足一个向量的元素使用标量实现 ===== //
+NEKIRA_REFLECT_TARGET_AVX2 uint64_t ReduceAdd64_AVX2(__m256i Values)
+{
+    alignas(32) uint64_t Lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Lanes), Values);
+    return (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+}
+
+// 32位整数扩展为64位后累加，每次8个元素
+template <typename ValueType>
+NEKIRA_REFLECT_TARGET_AVX2 uint64_t Sum32_AVX2(const ValueType* Values, size_t Count)
+{
+    __m256i Low = _mm256_setzero_si256();
+    __m256i High = _mm256_setzero_si256();
+    size_t  Index = 0;
+
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        const __m256i Loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index));
+
+        if constexpr (std::is_signed_v<ValueType>)
+        {
+            Low = _mm256_add_epi64(Low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(Loaded)));
+            High = _mm256_add_epi64(High, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(Loaded, 1)));
+        }
+        else
+        {
+            Low = _mm256_add_epi64(Low, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(Loaded)));
+            High = _mm256_add_epi64(High, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(Loaded, 1)));
+        }
+    }
+
+    using SumType = std::conditional_t<std::is_signed_v<ValueType>, int64_t, uint64_t>;
+
+    return ReduceAdd64_AVX2(_mm256_add_epi64(Low, High)) +
+           static_cast<uint64_t>(SumScalar<ValueType, SumType>(Values + Index, Count - Index));
+}
+
+// 64位整数按补码累加，有符号与无符号相同，每次8个元素
+NEKIRA_REFLECT_TARGET_AVX2 uint64_t Sum64_AVX2(const uint64_t* Values, size_t Count)
+{
+    __m256i Sum0 = _mm256_setzero_si256();
+    __m256i Sum1 = _mm256_setzero_si256();
+    size_t  Index = 0;
+
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        Sum0 = _mm256_add_epi64(Sum0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index)));
+        Sum1 = _mm256_add_epi64(Sum1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index + 4)));
+    }
+
+    return ReduceAdd64_AVX2(_mm256_add_epi64(Sum0, Sum1)) + SumScalar<uint64_t, uint64_t>(Values + Index, Count - Index);
+}
+
+// 4个独立的累加向量隐藏加法的延迟，每次32个元素
+NEKIRA_REFLECT_TARGET_AVX2 float SumFloat_AVX2(const float* Values, size_t Count)
+{
+    __m256 Sums[4] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    size_t Index = 0;
+
+    for (; Index + 32 <= Count; Index += 32)
+    {
+        Sums[0] = _mm256_add_ps(Sums[0], _mm256_loadu_ps(Values + Index));
+        Sums[1] = _mm256_add_ps(Sums[1], _mm256_loadu_ps(Values + Index + 8));
+        Sums[2] = _mm256_add_ps(Sums[2], _mm256_loadu_ps(Values + Index + 16));
+        Sums[3] = _mm256_add_ps(Sums[3], _mm256_loadu_ps(Values + Index + 24));
+    }
+
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        Sums[0] = _mm256_add_ps(Sums[0], _mm256_loadu_ps(Values + Index));
+    }
+
+    alignas(32) float Lanes[8];
+    _mm256_store_ps(Lanes, _mm256_add_ps(_mm256_add_ps(Sums[0], Sums[1]), _mm256_add_ps(Sums[2], Sums[3])));
+
+    const float Result = ((Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3])) + ((Lanes[4] + Lanes[5]) + (Lanes[6] + Lanes[7]));
+
+    return Result + SumScalar<float, float>(Values + Index, Count - Index);
+}
+
+NEKIRA_REFLECT_TARGET_AVX2 double SumDouble_AVX2(const double* Values, size_t Count)
+{
+    __m256d Sums[4] = {_mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd()};
+    size_t  Index = 0;
+
+    for (; Index + 16 <= Count; Index += 16)
+    {
+        Sums[0] = _mm256_add_pd(Sums[0], _mm256_loadu_pd(Values + Index));
+        Sums[1] = _mm256_add_pd(Sums[1], _mm256_loadu_pd(Values + Index + 4));
+        Sums[2] = _mm256_add_pd(Sums[2], _mm256_loadu_pd(Values + Index + 8));
+        Sums[3] = _mm256_add_pd(Sums[3], _mm256_loadu_pd(Values + Index + 12));
+    }
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        Sums[0] = _mm256_add_pd(Sums[0], _mm256_loadu_pd(Values + Index));
+    }
+
+    alignas(32) double Lanes[4];
+    _mm256_store_pd(Lanes, _mm256_add_pd(_mm256_add_pd(Sums[0], Sums[1]), _mm256_add_pd(Sums[2], Sums[3])));
+
+    const double Result = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+
+    return Result + SumScalar<double, double>(Values + Index, Count - Index);
+}
+
+// 最值向量的各通道以Min与Max为初值，结束后逐通道合并
+template <typename ValueType>
+void FoldLanes(const ValueType* MinLanes, const ValueType* MaxLanes, size_t LaneCount, ValueType& Min, ValueType& Max)
+{
+    for (size_t Lane = 0; Lane < LaneCount; ++Lane)
+    {
+        Min = MinLanes[Lane] < Min ? MinLanes[Lane] : Min;
+        Max = Max < MaxLanes[Lane] ? MaxLanes[Lane] : Max;
+    }
+}
+
+template <typename ValueType>
+NEKIRA_REFLECT_TARGET_AVX2 void MinMax32_AVX2(const ValueType* Values, size_t Count, ValueType& Min, ValueType& Max)
+{
+    __m256i Mins = _mm256_set1_epi32(static_cast<int>(Min));
+    __m256i Maxs = _mm256_set1_epi32(static_cast<int>(Max));
+    size_t  Index = 0;
+
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        const __m256i Loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index));
+
+        if constexpr (std::is_signed_v<ValueType>)
+        {
+            Mins = _mm256_min_epi32(Loaded, Mins);
+            Maxs = _mm256_max_epi32(Loaded, Maxs);
+        }
+        else
+        {
+            Mins = _mm256_min_epu32(Loaded, Mins);
+            Maxs = _mm256_max_epu32(Loaded, Maxs);
+        }
+    }
+
+    alignas(32) ValueType MinLanes[8];
+    alignas(32) ValueType MaxLanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(MinLanes), Mins);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(MaxLanes), Maxs);
+
+    FoldLanes(MinLanes, MaxLanes, 8, Min, Max);
+    MinMaxScalar(Values + Index, Count - Index, Min, Max);
+}
+
+// AVX2没有64位整数的min/max，比较后混合；无符号数翻转符号位后按有符号比较
+template <typename ValueType>
+NEKIRA_REFLECT_TARGET_AVX2 void MinMax64_AVX2(const ValueType* Values, size_t Count, ValueType& Min, ValueType& Max)
+{
+    const __m256i Bias = std::is_signed_v<ValueType> ? _mm256_setzero_si256()
+                                                     : _mm256_set1_epi64x(static_cast<long long>(1ULL << 63));
+
+    __m256i Mins = _mm256_set1_epi64x(static_cast<long long>(Min));
+    __m256i Maxs = _mm256_set1_epi64x(static_cast<long long>(Max));
+    size_t  Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        const __m256i Loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index));
+        const __m256i Biased = _mm256_xor_si256(Loaded, Bias);
+
+        const __m256i BelowMin = _mm256_cmpgt_epi64(_mm256_xor_si256(Mins, Bias), Biased);
+        const __m256i AboveMax = _mm256_cmpgt_epi64(Biased, _mm256_xor_si256(Maxs, Bias));
+
+        Mins = _mm256_blendv_epi8(Mins, Loaded, BelowMin);
+        Maxs = _mm256_blendv_epi8(Maxs, Loaded, AboveMax);
+    }
+
+    alignas(32) ValueType MinLanes[4];
+    alignas(32) ValueType MaxLanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(MinLanes), Mins);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(MaxLanes), Maxs);
+
+    FoldLanes(MinLanes, MaxLanes, 4, Min, Max);
+    MinMaxScalar(Values + Index, Count - Index, Min, Max);
+}
+
+// [INFO] min/max指令在任一操作数为NaN时返回第二个操作数，与标量的 Value < Min ? Value : Min 一致
+NEKIRA_REFLECT_TARGET_AVX2 void MinMaxFloat_AVX2(const float* Values, size_t Count, float& Min, float& Max)
+{
+    __m256 Mins = _mm256_set1_ps(Min);
+    __m256 Maxs = _mm256_set1_ps(Max);
+    size_t Index = 0;
+
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        const __m256 Loaded = _mm256_loadu_ps(Values + Index);
+        Mins = _mm256_min_ps(Loaded, Mins);
+        Maxs = _mm256_max_ps(Loaded, Maxs);
+    }
+
+    alignas(32) float MinLanes[8];
+    alignas(32) float MaxLanes[8];
+    _mm256_store_ps(MinLanes, Mins);
+    _mm256_store_ps(MaxLanes, Maxs);
+
+    FoldLanes(MinLanes, MaxLanes, 8, Min, Max);
+    MinMaxScalar(Values + Index, Count - Index, Min, Max);
+}
+
+NEKIRA_REFLECT_TARGET_AVX2 void MinMaxDouble_AVX2(const double* Values, size_t Count, double& Min, double& Max)
+{
+    __m256d Mins = _mm256_set1_pd(Min);
+    __m256d Maxs = _mm256_set1_pd(Max);
+    size_t  Index = 0;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        const __m256d Loaded = _mm256_loadu_pd(Values + Index);
+        Mins = _mm256_min_pd(Loaded, Mins);
+        Maxs = _mm256_max_pd(Loaded, Maxs);
+    }
+
+    alignas(32) double MinLanes[4];
+    alignas(32) double MaxLanes[4];
+    _mm256_store_pd(MinLanes, Mins);
+    _mm256_store_pd(MaxLanes, Maxs);
+
+    FoldLanes(MinLanes, MaxLanes, 4, Min, Max);
+    MinMaxScalar(Values + Index, Count - Index, Min, Max);
+}
+
+// 比较结果的掩码按位计数，浮点数使用有序比较，NaN与任何值都不相等
+template <typename ValueType>
+NEKIRA_REFLECT_TARGET_AVX2 size_t Count_AVX2(const ValueType* Values, size_t Count, ValueType Value)
+{
+    constexpr size_t LaneCount = 32 / sizeof(ValueType);
+
+    size_t Result = 0;
+    size_t Index = 0;
+
+    for (; Index + LaneCount <= Count; Index += LaneCount)
+    {
+        int Mask = 0;
+
+        if constexpr (std::is_same_v<ValueType, float>)
+        {
+            Mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(Values + Index), _mm256_set1_ps(Value), _CMP_EQ_OQ));
+        }
+        else if constexpr (std::is_same_v<ValueType, double>)
+        {
+            Mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(Values + Index), _mm256_set1_pd(Value), _CMP_EQ_OQ));
+        }
+        else if constexpr (sizeof(ValueType) == 4)
+        {
+            const __m256i Loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index));
+            Mask = _mm256_movemask_ps(
+                _mm256_castsi256_ps(_mm256_cmpeq_epi32(Loaded, _mm256_set1_epi32(static_cast<int>(Value)))));
+        }
+        else
+        {
+            const __m256i Loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Values + Index));
+            Mask = _mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpeq_epi64(Loaded, _mm256_set1_epi64x(static_cast<long long>(Value)))));
+        }
+
+        Result += static_cast<size_t>(std::popcount(static_cast<unsigned>(Mask)));
+    }
+
+    return Result + CountScalar(Values + Index, Count - Index, Value);
+}
+#endif
+
+// 按类型选择AVX2或标量实现
+template <typename ValueType, typename SumType>
+SumType DenseSumImpl(const ValueType* Values, size_t Count)
+{
+#if NEKIRA_REFLECT_BATCH_X86
+    if (IsAVX2Active())
+    {
+        if constexpr (std::is_same_v<ValueType, float>)
+        {
+            return SumFloat_AVX2(Values, Count);
+        }
+        else if constexpr (std::is_same_v<ValueType, double>)
+        {
+            return SumDouble_AVX2(Values, Count);
+        }
+        else if constexpr (sizeof(ValueType) == 4)
+        {
+            return static_cast<SumType>(Sum32_AVX2(Values, Count));
+        }
+        else
+        {
+            return static_cast<SumType>(Sum64_AVX2(reinterpret_cast<const uint64_t*>(Values), Count));
+        }
+    }
+#endif
+
+    return SumScalar<ValueType, SumType>(Values, Count);
+}
+
+template <typename ValueType>
+void DenseMinMaxImpl(const ValueType* Values, size_t Count, ValueType& Min, ValueType& Max)
+{
+#if NEKIRA_REFLECT_BATCH_X86
+    if (IsAVX2Active())
+    {
+        if constexpr (std::is_same_v<ValueType, float>)
+        {
+            MinMaxFloat_AVX2(Values, Count, Min, Max);
+        }
+        else if constexpr (std::is_same_v<ValueType, double>)
+        {
+            MinMaxDouble_AVX2(Values, Count, Min, Max);
+        }
+        else if constexpr (sizeof(ValueType) == 4)
+        {
+            MinMax32_AVX2(Values, Count, Min, Max);
+        }
+        else
+        {
+            MinMax64_AVX2(Values, Count, Min, Max);
+        }
+
+        return;
+    }
+#endif
+
+    MinMaxScalar(Values, Count, Min, Max);
+}
+
+template <typename ValueType>
+size_t DenseCountImpl(const ValueType* Values, size_t Count, ValueType Value)
+{
+#if NEKIRA_REFLECT_BATCH_X86
+    if (IsAVX2Active())
+    {
+        return Count_AVX2(Values, Count, Value);
+    }
+#endif
+
+    return CountScalar(Values, Count, Value);
+}
+
+} // namespace
+
+// 获取批量运算当前使用的指令集
+BatchInstructionSet GetBatchInstructionSet()
+{
+    return ActiveInstructionSet.load(std::memory_order_relaxed);
+}
+
+// 限制批量运算可使用的指令集
+void SetBatchInstructionSet(BatchInstructionSet InstructionSet)
+{
+    ActiveInstructionSet.store(std::min(InstructionSet, SupportedInstructionSet), std::memory_order_relaxed);
+}
+
+// 收集成员变量
+void GatherField(const ObjectSpan& Objects, const MemberVarInfo* VarInfo, void* Dense)
+{
+    if (!CanCopy(VarInfo, "GatherField") || Objects.Data == nullptr)
+    {
+        return;
+    }
+
+    const char*  Src = static_cast<const char*>(Objects.Data) + VarInfo->GetOffset();
+    const size_t Size = VarInfo->GetSize();
+    auto*        DenseBytes = static_cast<char*>(Dense);
+
+    if (VarInfo->GetTypeOps()->bTriviallyCopyable)
+    {
+        GatherTrivial(Src, Objects.Stride, Objects.Count, Size, DenseBytes);
+        return;
+    }
+
+    const auto Copy = VarInfo->GetTypeOps()->Copy;
+
+    for (size_t Index = 0; Index < Objects.Count; ++Index, Src += Objects.Stride)
+    {
+        Copy(DenseBytes + Index * Size, Src);
+    }
+}
+
+// 分发成员变量
+void ScatterField(const ObjectSpan& Objects, const MemberVarInfo* VarInfo, const void* Dense)
+{
+    if (!CanCopy(VarInfo, "ScatterField") || Objects.Data == nullptr)
+    {
+        return;
+    }
+
+    char*        Dst = static_cast<char*>(Objects.Data) + VarInfo->GetOffset();
+    const size_t Size = VarInfo->GetSize();
+    const auto*  DenseBytes = static_cast<const char*>(Dense);
+
+    if (VarInfo->GetTypeOps()->bTriviallyCopyable)
+    {
+        ScatterTrivial(Dst, Objects.Stride, Objects.Count, Size, DenseBytes);
+    }
+    else
+    {
+        const auto Copy = VarInfo->GetTypeOps()->Copy;
+
+        for (size_t Index = 0; Index < Objects.Count; ++Index, Dst += Objects.Stride)
+        {
+            Copy(Dst, DenseBytes + Index * Size);
+        }
+    }
+
+    MarkDirtyField(Objects, Objects.Count, VarInfo);
+}
+
+// 在两组对象之间复制成员变量
+void CopyField(const ObjectSpan& Dst, const ObjectSpan& Src, const MemberVarInfo* VarInfo)
+{
+    if (!CanCopy(VarInfo, "CopyField") || Dst.Data == nullptr || Src.Data == nullptr)
+    {
+        return;
+    }
+
+    const size_t Offset = VarInfo->GetOffset();
+    const size_t Size = VarInfo->GetSize();
+    const size_t Count = std::min(Dst.Count, Src.Count);
+
+    char*       DstBytes = static_cast<char*>(Dst.Data) + Offset;
+    const char* SrcBytes = static_cast<const char*>(Src.Data) + Offset;
+
+    // 经由栈上的小缓冲区分块收集再分发，收集时可使用SIMD
+    constexpr size_t BufferSize = 4096;
+
+    if (!VarInfo->GetTypeOps()->bTriviallyCopyable)
+    {
+        const auto Copy = VarInfo->GetTypeOps()->Copy;
+
+        for (size_t Index = 0; Index < Count; ++Index, DstBytes += Dst.Stride, SrcBytes += Src.Stride)
+        {
+            Copy(DstBytes, SrcBytes);
+        }
+    }
+    else if (Size > BufferSize)
+    {
+        for (size_t Index = 0; Index < Count; ++Index, DstBytes += Dst.Stride, SrcBytes += Src.Stride)
+        {
+            std::memcpy(DstBytes, SrcBytes, Size);
+        }
+    }
+    else
+    {
+        alignas(32) char Buffer[BufferSize];
+
+        const size_t ChunkCount = BufferSize / Size;
+
+        for (size_t Index = 0; Index < Count; Index += ChunkCount)
+        {
+            const size_t Chunk = std::min(ChunkCount, Count - Index);
+
+            GatherTrivial(SrcBytes + Index * Src.Stride, Src.Stride, Chunk, Size, Buffer);
+            ScatterTrivial(DstBytes + Index * Dst.Stride, Dst.Stride, Chunk, Size, Buffer);
+        }
+    }
+
+    MarkDirtyField(Dst, Count, VarInfo);
+}
+
+// 按字节收集相隔Stride的元素
+void GatherStrided(const void* Src, size_t Stride, size_t Count, size_t Size, void* Dense)
+{
+    GatherTrivial(static_cast<const char*>(Src), Stride, Count, Size, static_cast<char*>(Dense));
+}
+
+// ===== 连续数组的归约 ===== //
+int64_t DenseSum(const int32_t* Values, size_t Count)
+{
+    return DenseSumImpl<int32_t, int64_t>(Values, Count);
+}
+
+uint64_t DenseSum(const uint32_t* Values, size_t Count)
+{
+    return DenseSumImpl<uint32_t, uint64_t>(Values, Count);
+}
+
+int64_t DenseSum(const int64_t* Values, size_t Count)
+{
+    return DenseSumImpl<int64_t, int64_t>(Values, Count);
+}
+
+uint64_t DenseSum(const uint64_t* Values, size_t Count)
+{
+    return DenseSumImpl<uint64_t, uint64_t>(Values, Count);
+}
+
+float DenseSum(const float* Values, size_t Count)
+{
+    return DenseSumImpl<float, float>(Values, Count);
+}
+
+double DenseSum(const double* Values, size_t Count)
+{
+    return DenseSumImpl<double, double>(Values, Count);
+}
+
+void DenseMinMax(const int32_t* Values, size_t Count, int32_t& Min, int32_t& Max)
+{
+    DenseMinMaxImpl(Values, Count, Min, Max);
+}
+
+void DenseMinMax(const uint32_t* Values, size_t Count, uint32_t& Min, uint32_t& Max)
+{
+    DenseMinMaxImpl(Values, Count, Min, Max);
+}
+
+void DenseMinMax(const int64_t* Values, size_t Count, int64_t& Min, int64_t& Max)
+{
+    DenseMinMaxImpl(Values, Count, Min, Max);
+}
+
+void DenseMinMax(const uint64_t* Values, size_t Count, uint64_t& Min, uint64_t& Max)
+{
+    DenseMinMaxImpl(Values, Count, Min, Max);
+}
+
+void DenseMinMax(const float* Values, size_t Count, float& Min, float& Max)
+{
+    DenseMinMaxImpl(Values, Count, Min, Max);
+}
+
+void DenseMinMax(const double* Values, size_t Count, double& Min, double& Max)
+{
+    DenseMinMaxImpl(Values, Count, Min, Max);
+}
+
+size_t DenseCount(const int32_t* Values, size_t Count, int32_t Value)
+{
+    return DenseCountImpl(Values, Count, Value);
+}
+
+size_t DenseCount(const uint32_t* Values, size_t Count, uint32_t Value)
+{
+    return DenseCountImpl(Values, Count, Value);
+}
+
+size_t DenseCount(const int64_t* Values, size_t Count, int64_t Value)
+{
+    return DenseCountImpl(Values, Count, Value);
+}
+
+size_t DenseCount(const uint64_t* Values, size_t Count, uint64_t Value)
+{
+    return DenseCountImpl(Values, Count, Value);
+}
+
+size_t DenseCount(const float* Values, size_t Count, float Value)
+{
+    return DenseCountImpl(Values, Count, Value);
+}
+
+size_t DenseCount(const double* Values, size_t Count, double Value)
+{
+    return DenseCountImpl(Values, Count, Value);
+}
+
+} // namespace NekiraReflect
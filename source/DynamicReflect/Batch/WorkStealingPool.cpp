@@ -0,0 +1,323 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Batch/WorkStealingPool.hpp>
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+
+namespace NekiraReflect
+{
+
+namespace
+{
+// 当前线程是否正在执行并行任务，嵌套的ParallelFor据此串行执行
+thread_local bool bInsideParallelJob = false;
+
+constexpr uint64_t PackRange(uint64_t Begin, uint64_t End)
+{
+    return Begin | (End << 32);
+}
+
+constexpr uint64_t RangeBegin(uint64_t Range)
+{
+    return Range & 0xFFFFFFFFull;
+}
+
+constexpr uint64_t RangeEnd(uint64_t Range)
+{
+    return Range >> 32;
+}
+
+// 自动选择块大小时每个线程分到的块数，块数多于线程数使窃取能平衡负载
+constexpr size_t ChunksPerThread = 8;
+
+} // namespace
+
+WorkStealingPool& WorkStealingPool::Get()
+{
+    static WorkStealingPool Instance;
+    return Instance;
+}
+
+WorkStealingPool::WorkStealingPool()
+{
+    ThreadCount.store(std::max<size_t>(1, std::thread::hardware_concurrency()), std::memory_order_relaxed);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    StopWorkers();
+}
+
+size_t WorkStealingPool::GetThreadCount() const
+{
+    return ThreadCount.load(std::memory_order_relaxed);
+}
+
+void WorkStealingPool::SetThreadCount(size_t threadCount)
+{
+    std::lock_guard<std::mutex> Lock(SubmitMutex);
+
+    StopWorkers();
+    ThreadCount.store(std::max<size_t>(1, threadCount), std::memory_order_relaxed);
+}
+
+void WorkStealingPool::ParallelFor(size_t Count, const ParallelOptions& Options, RangeFunction Function, void* Context)
+{
+    if (Count == 0)
+    {
+        return;
+    }
+
+    const size_t Threads = ThreadCount.load(std::memory_order_relaxed);
+    const size_t MaxThreads = Options.MaxThreads == 0 ? Threads : std::min(Options.MaxThreads, Threads);
+
+    // 块的下标须能放入32位
+    size_t Grain = Options.GrainSize != 0 ? Options.GrainSize : Count / (MaxThreads * ChunksPerThread);
+    Grain = std::max({Grain, size_t{1}, Count / std::numeric_limits<uint32_t>::max() + 1});
+
+    const size_t ChunkCount = (Count + Grain - 1) / Grain;
+    size_t       Participants = std::min(MaxThreads, ChunkCount);
+
+    if (Participants <= 1 || bInsideParallelJob)
+    {
+        for (size_t Begin = 0; Begin < Count; Begin += Grain)
+        {
+            Function(Context, Begin, std::min(Count, Begin + Grain));
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> SubmitLock(SubmitMutex);
+
+    // 持有SubmitMutex时线程数不会变化，此前读到的值可能已被SetThreadCount修改
+    const size_t CurrentThreads = ThreadCount.load(std::memory_order_relaxed);
+
+    if (Workers.size() + 1 < CurrentThreads)
+    {
+        StopWorkers();
+        StartWorkers(CurrentThreads - 1);
+    }
+
+    Participants = std::min(Participants, Workers.size() + 1);
+
+    // 每个参与线程先分到连续的一段块
+    for (size_t Participant = 0; Participant < Participants; ++Participant)
+    {
+        const uint64_t Begin = ChunkCount * Participant / Participants;
+        const uint64_t End = ChunkCount * (Participant + 1) / Participants;
+        Ranges[Participant].Range.store(PackRange(Begin, End), std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(StateMutex);
+
+        JobFunction = Function;
+        JobContext = Context;
+        JobCount = Count;
+        JobGrain = Grain;
+        JobParticipants = Participants;
+        PendingWorkers = Participants - 1;
+        bJobCancelled.store(false, std::memory_order_relaxed);
+        ++JobGeneration;
+    }
+
+    WorkCondition.notify_all();
+
+    // 离开作用域时(包括Function在调用线程上抛出异常时)复位标记，并等待其他参与线程完成，
+    // 之后Context与Ranges才可被释放或被下一个任务复用
+    struct JobGuard
+    {
+        WorkStealingPool& Pool;
+        const int         ExceptionCount = std::uncaught_exceptions();
+
+        ~JobGuard()
+        {
+            bInsideParallelJob = false;
+
+            if (std::uncaught_exceptions() > ExceptionCount)
+            {
+                Pool.bJobCancelled.store(true, std::memory_order_relaxed);
+            }
+
+            std::unique_lock<std::mutex> Lock(Pool.StateMutex);
+            Pool.DoneCondition.wait(Lock, [this] { return Pool.PendingWorkers == 0; });
+        }
+    };
+
+    bInsideParallelJob = true;
+
+    JobGuard Guard{*this};
+    RunParticipant(0);
+}
+
+void WorkStealingPool::StartWorkers(size_t WorkerCount)
+{
+    Ranges = std::make_unique<ChunkRange[]>(WorkerCount + 1);
+
+    // 工作线程只处理启动之后发布的任务
+    uint64_t Generation = 0;
+    {
+        std::lock_guard<std::mutex> Lock(StateMutex);
+        bStopping = false;
+        Generation = JobGeneration;
+    }
+
+    Workers.reserve(WorkerCount);
+
+    for (size_t WorkerIndex = 0; WorkerIndex < WorkerCount; ++WorkerIndex)
+    {
+        Workers.emplace_back([this, WorkerIndex, Generation] { WorkerLoop(WorkerIndex, Generation); });
+    }
+}
+
+void WorkStealingPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> Lock(StateMutex);
+        bStopping = true;
+    }
+
+    WorkCondition.notify_all();
+
+    for (auto& Worker : Workers)
+    {
+        Worker.join();
+    }
+
+    Workers.clear();
+}
+
+void WorkStealingPool::WorkerLoop(size_t WorkerIndex, uint64_t SeenGeneration)
+{
+    bInsideParallelJob = true;
+
+    // 调用线程是参与线程0，工作线程从1开始
+    const size_t Participant = WorkerIndex + 1;
+
+    while (true)
+    {
+        size_t Participants = 0;
+        {
+            std::unique_lock<std::mutex> Lock(StateMutex);
+            WorkCondition.wait(Lock, [&] { return bStopping || JobGeneration != SeenGeneration; });
+
+            if (bStopping)
+            {
+                return;
+            }
+
+            SeenGeneration = JobGeneration;
+            Participants = JobParticipants;
+        }
+
+        if (Participant >= Participants)
+        {
+            continue;
+        }
+
+        RunParticipant(Participant);
+
+        bool bLast = false;
+        {
+            std::lock_guard<std::mutex> Lock(StateMutex);
+            bLast = --PendingWorkers == 0;
+        }
+
+        if (bLast)
+        {
+            DoneCondition.notify_one();
+        }
+    }
+}
+
+void WorkStealingPool::RunParticipant(size_t Participant)
+{
+    size_t Chunk = 0;
+
+    while (!bJobCancelled.load(std::memory_order_relaxed))
+    {
+        if (PopChunk(Participant, Chunk))
+        {
+            const size_t Begin = Chunk * JobGrain;
+            JobFunction(JobContext, Begin, std::min(JobCount, Begin + JobGrain));
+        }
+        else if (!StealChunks(Participant))
+        {
+            break;
+        }
+    }
+}
+
+// 从自己区间的前端取一块
+bool WorkStealingPool::PopChunk(size_t Participant, size_t& Chunk)
+{
+    auto&    Range = Ranges[Participant].Range;
+    uint64_t Current = Range.load(std::memory_order_acquire);
+
+    while (RangeBegin(Current) < RangeEnd(Current))
+    {
+        if (Range.compare_exchange_weak(Current, PackRange(RangeBegin(Current) + 1, RangeEnd(Current)),
+                                        std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            Chunk = static_cast<size_t>(RangeBegin(Current));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// 自己的区间已空时，从其他参与线程的区间后端窃取一半(至少一块)放入自己的区间
+// [INFO] 每块只会被分出一次，非空区间不会重复出现，因此CAS没有ABA问题
+bool WorkStealingPool::StealChunks(size_t Thief)
+{
+    const size_t Participants = JobParticipants;
+
+    for (size_t Step = 1; Step < Participants; ++Step)
+    {
+        auto&    VictimRange = Ranges[(Thief + Step) % Participants].Range;
+        uint64_t Current = VictimRange.load(std::memory_order_acquire);
+
+        while (RangeBegin(Current) < RangeEnd(Current))
+        {
+            const uint64_t Begin = RangeBegin(Current);
+            const uint64_t End = RangeEnd(Current);
+            const uint64_t Split = Begin + (End - Begin) / 2;
+
+            if (VictimRange.compare_exchange_weak(Current, PackRange(Begin, Split), std::memory_order_acq_rel,
+                                                  std::memory_order_acquire))
+            {
+                Ranges[Thief].Range.store(PackRange(Split, End), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+} // namespace NekiraReflect
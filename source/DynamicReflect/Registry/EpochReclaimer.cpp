@@ -0,0 +1,180 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Registry/EpochReclaimer.hpp>
+#include <thread>
+
+
+namespace NekiraReflect
+{
+
+EpochReclaimer::~EpochReclaimer()
+{
+    for (const auto& Retired : RetiredObjects)
+    {
+        Retired.Deleter(Retired.Object);
+    }
+
+    ReaderSlot* Slot = SlotHead.load(std::memory_order_acquire);
+
+    while (Slot != nullptr)
+    {
+        ReaderSlot* Next = Slot->Next;
+        delete Slot;
+        Slot = Next;
+    }
+}
+
+// 释放所有已无读者可见的对象
+void EpochReclaimer::Collect()
+{
+    const uint64_t MinEpoch = GetMinActiveEpoch();
+
+    // 对象在纪元E被回收时，仍可能读到它的读者所公布的纪元一定小于E
+    while (!RetiredObjects.empty() && RetiredObjects.front().Epoch <= MinEpoch)
+    {
+        const RetiredObject Retired = RetiredObjects.front();
+        RetiredObjects.pop_front();
+
+        Retired.Deleter(Retired.Object);
+    }
+}
+
+// 等待当前所有读者离开后释放全部待回收对象
+// [INFO] 调用线程自身不能处于读取区内，否则会永远等待
+void EpochReclaimer::Synchronize()
+{
+    const uint64_t TargetEpoch = GlobalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+    while (GetMinActiveEpoch() < TargetEpoch)
+    {
+        std::this_thread::yield();
+    }
+
+    Collect();
+}
+
+EpochReclaimer::ReaderSlot* EpochReclaimer::EnterRead()
+{
+    // 每个线程缓存自己的槽位，线程退出时归还以便复用
+    struct ThreadSlot
+    {
+        const EpochReclaimer* Owner = nullptr;
+        ReaderSlot*           Slot = nullptr;
+
+        ~ThreadSlot()
+        {
+            if (Slot != nullptr)
+            {
+                Slot->bInUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local ThreadSlot Cache;
+
+    if (Cache.Owner != this)
+    {
+        if (Cache.Slot != nullptr && Cache.Slot->Depth == 0)
+        {
+            Cache.Slot->bInUse.store(false, std::memory_order_release);
+        }
+
+        Cache.Slot = AcquireSlot();
+        Cache.Owner = this;
+    }
+
+    ReaderSlot* Slot = Cache.Slot;
+
+    // 仅最外层读取公布纪元，之后对共享指针的读取必须位于此次写入之后
+    if (Slot->Depth++ == 0)
+    {
+        Slot->Epoch.store(GlobalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    }
+
+    return Slot;
+}
+
+void EpochReclaimer::LeaveRead(ReaderSlot* Slot)
+{
+    if (--Slot->Depth == 0)
+    {
+        Slot->Epoch.store(0, std::memory_order_release);
+    }
+}
+
+EpochReclaimer::ReaderSlot* EpochReclaimer::AcquireSlot()
+{
+    // 优先复用已退出线程的槽位
+    for (ReaderSlot* Slot = SlotHead.load(std::memory_order_acquire); Slot != nullptr; Slot = Slot->Next)
+    {
+        bool bExpected = false;
+
+        if (!Slot->bInUse.load(std::memory_order_relaxed)
+            && Slot->bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acq_rel))
+        {
+            return Slot;
+        }
+    }
+
+    auto* NewSlot = new ReaderSlot();
+    NewSlot->bInUse.store(true, std::memory_order_relaxed);
+
+    ReaderSlot* Head = SlotHead.load(std::memory_order_relaxed);
+
+    do
+    {
+        NewSlot->Next = Head;
+    } while (!SlotHead.compare_exchange_weak(Head, NewSlot, std::memory_order_release, std::memory_order_relaxed));
+
+    return NewSlot;
+}
+
+void EpochReclaimer::RetireImpl(void* Object, void (*Deleter)(void*))
+{
+    // 推进全局纪元，此后进入读取区的读者不可能再看到该对象
+    const uint64_t Epoch = GlobalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+    RetiredObjects.push_back(RetiredObject{Epoch, Object, Deleter});
+}
+
+// 当前活跃读者中最小的纪元
+uint64_t EpochReclaimer::GetMinActiveEpoch() const
+{
+    uint64_t MinEpoch = UINT64_MAX;
+
+    for (ReaderSlot* Slot = SlotHead.load(std::memory_order_acquire); Slot != nullptr; Slot = Slot->Next)
+    {
+        const uint64_t Epoch = Slot->Epoch.load(std::memory_order_seq_cst);
+
+        if (Epoch != 0 && Epoch < MinEpoch)
+        {
+            MinEpoch = Epoch;
+        }
+    }
+
+    return MinEpoch;
+}
+
+} // namespace NekiraReflect
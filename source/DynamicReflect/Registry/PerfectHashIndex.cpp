@@ -0,0 +1,140 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Registry/PerfectHashIndex.hpp>
+#include <algorithm>
+#include <numeric>
+
+
+namespace NekiraReflect
+{
+
+// 构建索引，Keys中存在重复时返回false
+bool PerfectHashIndex::Build(const std::vector<uint64_t>& Keys)
+{
+    std::vector<uint64_t> SortedKeys = Keys;
+    std::sort(SortedKeys.begin(), SortedKeys.end());
+
+    if (std::adjacent_find(SortedKeys.begin(), SortedKeys.end()) != SortedKeys.end())
+    {
+        return false;
+    }
+
+    // 分桶不均时更换种子重试
+    for (uint64_t TrySalt = 1; TrySalt <= 16; ++TrySalt)
+    {
+        if (TryBuild(Keys, TrySalt))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PerfectHashIndex::TryBuild(const std::vector<uint64_t>& Keys, uint64_t TrySalt)
+{
+    const auto KeyCount = static_cast<uint32_t>(Keys.size());
+
+    Salt = TrySalt;
+    SlotCount = KeyCount;
+    Seeds.clear();
+
+    if (KeyCount == 0)
+    {
+        return true;
+    }
+
+    // 平均每个桶约2个Key
+    const uint32_t BucketCount = std::max<uint32_t>(1, KeyCount / 2);
+    Seeds.assign(BucketCount, 0);
+
+    std::vector<std::vector<uint32_t>> Buckets(BucketCount);
+
+    for (uint32_t KeyIndex = 0; KeyIndex < KeyCount; ++KeyIndex)
+    {
+        Buckets[Reduce(Mix(Keys[KeyIndex], Salt), BucketCount)].push_back(KeyIndex);
+    }
+
+    // 先放置较大的桶，此时空闲槽位最多
+    std::vector<uint32_t> BucketOrder(BucketCount);
+    std::iota(BucketOrder.begin(), BucketOrder.end(), 0);
+    std::stable_sort(BucketOrder.begin(), BucketOrder.end(),
+                     [&Buckets](uint32_t Lhs, uint32_t Rhs) { return Buckets[Lhs].size() > Buckets[Rhs].size(); });
+
+    std::vector<bool>     Occupied(KeyCount, false);
+    std::vector<uint32_t> BucketSlots;
+
+    const uint64_t MaxAttempts = 64ull * KeyCount + 1024;
+
+    for (const uint32_t Bucket : BucketOrder)
+    {
+        const auto& BucketKeys = Buckets[Bucket];
+
+        if (BucketKeys.empty())
+        {
+            break;
+        }
+
+        bool bPlaced = false;
+
+        for (uint64_t Seed = 1; Seed <= MaxAttempts && Seed <= UINT32_MAX; ++Seed)
+        {
+            BucketSlots.clear();
+
+            for (const uint32_t KeyIndex : BucketKeys)
+            {
+                const uint32_t Slot = Reduce(Mix(Keys[KeyIndex], Seed), KeyCount);
+
+                if (Occupied[Slot] || std::find(BucketSlots.begin(), BucketSlots.end(), Slot) != BucketSlots.end())
+                {
+                    break;
+                }
+
+                BucketSlots.push_back(Slot);
+            }
+
+            if (BucketSlots.size() == BucketKeys.size())
+            {
+                for (const uint32_t Slot : BucketSlots)
+                {
+                    Occupied[Slot] = true;
+                }
+
+                Seeds[Bucket] = static_cast<uint32_t>(Seed);
+                bPlaced = true;
+                break;
+            }
+        }
+
+        if (!bPlaced)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace NekiraReflect
@@ -23,105 +23,1024 @@
  */
 
 
+#include <Registry/PerfectHashIndex.hpp>
 #include <Registry/ReflectionRegistry.hpp>
+#include <algorithm>
+#include <cstdint>
 
 namespace NekiraReflect
 {
 
+// 封存查找表所用的Key哈希
+// std::hash<std::type_index>会对类型名称字符串求哈希，这里改用std::type_info::name()返回的地址，
+// 每个std::type_info对象的地址唯一且无需读取字符串
+// [INFO] 跨动态库时同一类型可能存在地址不同的std::type_info，此时查找表会未命中，由调用方按TypeId回退
+inline uint64_t SealedKeyHash(std::type_index TypeIndex)
+{
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(TypeIndex.name()));
+}
+
+inline uint64_t SealedKeyHash(std::string_view Name)
+{
+    return std::hash<std::string_view>{}(Name);
+}
+
+// 封存后的扁平查找表，Entries按PerfectHashIndex给出的槽位排列
+template <typename KeyType, typename InfoType>
+struct SealedTable
+{
+    struct Entry
+    {
+        KeyType   Key;
+        InfoType* Info;
+    };
+
+    PerfectHashIndex   Index;
+    std::vector<Entry> Entries;
+
+    // 构建查找表，存在哈希冲突时返回false
+    template <typename MapType>
+    bool Build(const MapType& Source)
+    {
+        std::vector<uint64_t> Hashes;
+        Hashes.reserve(Source.size());
+
+        for (const auto& Pair : Source)
+        {
+            Hashes.push_back(SealedKeyHash(Pair.first));
+        }
+
+        if (!Index.Build(Hashes))
+        {
+            return false;
+        }
+
+        std::vector<std::pair<uint32_t, Entry>> Placed;
+        Placed.reserve(Source.size());
+
+        size_t HashIndex = 0;
+        for (const auto& [Key, Info] : Source)
+        {
+            Placed.push_back({Index.GetSlot(Hashes[HashIndex++]), Entry{Key, &*Info}});
+        }
+
+        std::sort(Placed.begin(), Placed.end(),
+                  [](const auto& Lhs, const auto& Rhs) { return Lhs.first < Rhs.first; });
+
+        Entries.reserve(Placed.size());
+        for (const auto& Pair : Placed)
+        {
+            Entries.push_back(Pair.second);
+        }
+
+        return true;
+    }
+
+    InfoType* Find(const KeyType& Key) const
+    {
+        if (Entries.empty())
+        {
+            return nullptr;
+        }
+
+        const Entry& Candidate = Entries[Index.GetSlot(SealedKeyHash(Key))];
+
+        return Candidate.Key == Key ? Candidate.Info : nullptr;
+    }
+};
+
+struct RegistrySnapshot
+{
+    // 封存后仅使用Sealed*查找表，否则使用哈希表
+    bool bSealed = false;
+
+    std::unordered_map<std::type_index, EnumTypeInfo*>  Enums;
+    std::unordered_map<std::type_index, ClassTypeInfo*> Classes;
+    std::unordered_map<std::string_view, EnumTypeInfo*>  EnumNames;
+    std::unordered_map<std::string_view, ClassTypeInfo*> ClassNames;
+
+    // 以TypeId为下标的数组，封存与否都会构建
+    std::vector<EnumTypeInfo*>  EnumsById;
+    std::vector<ClassTypeInfo*> ClassesById;
+
+    SealedTable<std::type_index, EnumTypeInfo>   SealedEnums;
+    SealedTable<std::type_index, ClassTypeInfo>  SealedClasses;
+    SealedTable<std::string_view, EnumTypeInfo>  SealedEnumNames;
+    SealedTable<std::string_view, ClassTypeInfo> SealedClassNames;
+
+    template <typename MapType, typename KeyType>
+    static auto FindIn(const MapType& Map, const KeyType& Key) -> decltype(Map.begin()->second)
+    {
+        const auto it = Map.find(Key);
+        return it != Map.end() ? it->second : nullptr;
+    }
+
+    // 封存查找表按std::type_info地址命中，地址不同但相等的std::type_index经TypeId回退到数组
+    EnumTypeInfo* FindEnum(std::type_index TypeIndex) const
+    {
+        if (!bSealed)
+        {
+            return FindIn(Enums, TypeIndex);
+        }
+
+        EnumTypeInfo* Result = SealedEnums.Find(TypeIndex);
+
+        return Result != nullptr ? Result : FindEnum(FindTypeId(TypeIndex));
+    }
+
+    ClassTypeInfo* FindClass(std::type_index TypeIndex) const
+    {
+        if (!bSealed)
+        {
+            return FindIn(Classes, TypeIndex);
+        }
+
+        ClassTypeInfo* Result = SealedClasses.Find(TypeIndex);
+
+        return Result != nullptr ? Result : FindClass(FindTypeId(TypeIndex));
+    }
+
+    EnumTypeInfo* FindEnum(TypeId Id) const
+    {
+        return Id < EnumsById.size() ? EnumsById[Id] : nullptr;
+    }
+
+    ClassTypeInfo* FindClass(TypeId Id) const
+    {
+        return Id < ClassesById.size() ? ClassesById[Id] : nullptr;
+    }
+
+    EnumTypeInfo* FindEnumByName(std::string_view Name) const
+    {
+        return bSealed ? SealedEnumNames.Find(Name) : FindIn(EnumNames, Name);
+    }
+
+    ClassTypeInfo* FindClassByName(std::string_view Name) const
+    {
+        return bSealed ? SealedClassNames.Find(Name) : FindIn(ClassNames, Name);
+    }
+};
+
+// 当前线程激活的模块，主模块为nullptr
+static thread_local ReflectionModule* ActiveModule = nullptr;
+
+// 当前线程嵌套的ScopedRegistrationBatch层数
+static thread_local int BatchDepth = 0;
+
+// 切换当前线程激活的模块，返回之前激活的模块
+static ReflectionModule* SwapActiveModule(ReflectionModule* Module)
+{
+    ReflectionModule* Previous = ActiveModule;
+    ActiveModule = Module;
+
+    return Previous;
+}
+
+// 执行延迟注册项的注册函数，每项只执行一次，并发的调用者会等待其完成
+static bool RunLazyRegistration(LazyRegistration* Entry)
+{
+    if (Entry == nullptr)
+    {
+        return false;
+    }
+
+    // 在记录该项时激活的模块中执行，使注册的类型归属于同一模块
+    std::call_once(Entry->Once, [Entry]() {
+        ReflectionModule* Previous = SwapActiveModule(Entry->Module);
+        Entry->Register();
+        SwapActiveModule(Previous);
+    });
+
+    return true;
+}
+
+// 移除属于指定模块的延迟注册项，并收集它们的TypeId
+template <typename MapType, typename NameMapType>
+static void EraseModuleLazyRegistrations(MapType& Registrations, NameMapType& Names, const ReflectionModule* Module,
+                                         std::vector<TypeId>& OutIds)
+{
+    for (auto it = Registrations.begin(); it != Registrations.end();)
+    {
+        if (it->second->Module != Module)
+        {
+            ++it;
+            continue;
+        }
+
+        const auto NameIt = Names.find(it->second->Name);
+
+        if (NameIt != Names.end() && NameIt->second == it->second.get())
+        {
+            Names.erase(NameIt);
+        }
+
+        OutIds.push_back(it->first);
+        it = Registrations.erase(it);
+    }
+}
+
+// 收集模块注册的类型自身的TypeId
+// [INFO] 成员变量、成员函数的类型(int、std::string等)可能被其他模块共享，且TypeIdOf<T>()缓存在静态变量中不会重新绑定，
+// 因此不能解绑；模块内独有的成员类型在卸载后仍指向模块内的std::type_info，不应在卸载后查询其std::type_index
+static void CollectTypeIds(const EnumTypeInfo& EnumInfo, std::vector<TypeId>& OutIds)
+{
+    OutIds.push_back(EnumInfo.GetTypeId());
+}
+
+static void CollectTypeIds(const ClassTypeInfo& ClassInfo, std::vector<TypeId>& OutIds)
+{
+    OutIds.push_back(ClassInfo.GetTypeId());
+}
+
+// 在延迟注册表中查找
+template <typename MapType, typename KeyType>
+static LazyRegistration* FindLazyIn(std::mutex& Mutex, const MapType& Registrations, const KeyType& Key)
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    const auto it = Registrations.find(Key);
+
+    if (it == Registrations.end())
+    {
+        return nullptr;
+    }
+
+    return &*it->second;
+}
+
+ReflectionRegistry::~ReflectionRegistry()
+{
+    delete Snapshot.load(std::memory_order_acquire);
+}
+
 ReflectionRegistry& ReflectionRegistry::Get()
 {
     static ReflectionRegistry Instance;
     return Instance;
 }
 
+// 按TypeId填充数组
+template <typename InfoMapType, typename InfoType>
+static void FillById(const InfoMapType& Infos, std::vector<InfoType*>& OutArray)
+{
+    TypeId MaxId = InvalidTypeId;
+
+    for (const auto& Pair : Infos)
+    {
+        MaxId = std::max(MaxId, Pair.second->GetTypeId());
+    }
+
+    OutArray.assign(static_cast<size_t>(MaxId) + 1, nullptr);
+
+    for (const auto& Pair : Infos)
+    {
+        OutArray[Pair.second->GetTypeId()] = Pair.second.get();
+    }
+}
+
+// 在当前快照上执行查询，未命中且当前线程在批量作用域内有尚未发布的注册时，发布后重试
+// [INFO] 其他线程的查询只读取已发布的快照，从不获取写锁
+template <typename LookupFunc>
+auto ReflectionRegistry::ReadSnapshot(LookupFunc&& Lookup) const
+{
+    using ResultType = std::invoke_result_t<LookupFunc&, const RegistrySnapshot&>;
+
+    {
+        EpochReclaimer::ReadGuard Guard(Reclaimer);
+
+        const RegistrySnapshot* Current = Snapshot.load(std::memory_order_seq_cst);
+
+        if (Current != nullptr)
+        {
+            if (ResultType Result = Lookup(*Current))
+            {
+                return Result;
+            }
+        }
+    }
+
+    if (BatchDepth == 0 || !bPendingPublish.load(std::memory_order_acquire))
+    {
+        return ResultType{nullptr};
+    }
+
+    PublishPending();
+
+    EpochReclaimer::ReadGuard Guard(Reclaimer);
+
+    const RegistrySnapshot* Current = Snapshot.load(std::memory_order_seq_cst);
+
+    return Current != nullptr ? Lookup(*Current) : ResultType{nullptr};
+}
+
+// 在当前快照上执行查询，仍未命中时执行对应的延迟注册后重试
+template <typename LookupFunc, typename FindLazyFunc>
+auto ReflectionRegistry::ReadSnapshotOrResolve(LookupFunc&& Lookup, FindLazyFunc&& FindLazy) const
+{
+    auto Result = ReadSnapshot(Lookup);
+
+    if (Result == nullptr && bHasLazyRegistrations.load(std::memory_order_acquire) && RunLazyRegistration(FindLazy()))
+    {
+        Result = ReadSnapshot(Lookup);
+    }
+
+    return Result;
+}
+
 // Register Enum Info
-void ReflectionRegistry::RegisterEnum(std::unique_ptr<EnumTypeInfo> EnumInfo)
+void ReflectionRegistry::RegisterEnum(ArenaPtr<EnumTypeInfo> EnumInfo)
 {
     const std::type_index TypeIndex = EnumInfo->GetTypeIndex();
+
+    // 未通过MakeEnumTypeInfo创建的Info可能尚未分配TypeId；
+    // 模块卸载后TypeIdOf<T>()仍缓存原来的TypeId，重新注册时需要重新绑定
+    const TypeId BoundId = GetOrCreateTypeId(TypeIndex);
+
+    if (EnumInfo->GetTypeId() == InvalidTypeId)
+    {
+        EnumInfo->SetTypeId(BoundId);
+    }
+
+    WarnIfSealed("RegisterEnum", EnumInfo->GetName());
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+
+    // 同一类型重复注册时，先移除旧的Info及其名称索引
+    auto Replaced = ExtractEnumLocked(TypeIndex);
+
+    // 同名的其他类型会被覆盖，需先擦除再插入，保证Key指向新的TypeInfo
+    const bool bNameTaken = EnumNames.erase(EnumInfo->GetName()) > 0;
+    EnumNames.emplace(EnumInfo->GetName(), EnumInfo.get());
+
+    TrackInActiveModuleLocked(EnumInfo.get());
+
     EnumInfos[TypeIndex] = std::move(EnumInfo);
+
+    // 快照可能仍指向被替换的Info，此时必须立即发布
+    if (Replaced || bNameTaken)
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+        PublishLocked();
+        Reclaimer.Retire(std::move(Replaced));
+        Reclaimer.Collect();
+    }
+    else if (BatchDepth > 0)
+    {
+        // 批量作用域内的新类型在作用域结束时发布，派生类也在发布时才合并新注册的基类
+        bPendingPublish.store(true, std::memory_order_release);
+        Generation.fetch_add(1, std::memory_order_release);
+    }
+    else
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+        PublishLocked();
+    }
 }
 
 // Register Class Info
-void ReflectionRegistry::RegisterClass(std::unique_ptr<ClassTypeInfo> ClassInfo)
+void ReflectionRegistry::RegisterClass(ArenaPtr<ClassTypeInfo> ClassInfo)
 {
     const std::type_index TypeIndex = ClassInfo->GetTypeIndex();
+
+    // 未通过MakeClassTypeInfo创建的Info可能尚未分配TypeId；
+    // 模块卸载后TypeIdOf<T>()仍缓存原来的TypeId，重新注册时需要重新绑定
+    const TypeId BoundId = GetOrCreateTypeId(TypeIndex);
+
+    if (ClassInfo->GetTypeId() == InvalidTypeId)
+    {
+        ClassInfo->SetTypeId(BoundId);
+    }
+
+    WarnIfSealed("RegisterClass", ClassInfo->GetName());
+
+    // 延迟注册的基类先于派生类注册，使派生类发布时即可合并其成员；注册函数会获取写锁，必须在锁外执行
+    if (bHasLazyRegistrations.load(std::memory_order_acquire))
+    {
+        for (const auto& Base : ClassInfo->GetBaseClasses())
+        {
+            GetClassInfo(Base.Id);
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+
+    // 同一类型重复注册时，先移除旧的Info及其名称索引
+    auto Replaced = ExtractClassLocked(TypeIndex);
+
+    // 同名的其他类型会被覆盖，需先擦除再插入，保证Key指向新的TypeInfo
+    const bool bNameTaken = ClassNames.erase(ClassInfo->GetName()) > 0;
+    ClassNames.emplace(ClassInfo->GetName(), ClassInfo.get());
+
+    TrackInActiveModuleLocked(ClassInfo.get());
+
+    // 合并基类生成的成员表分配在同一模块的内存池中
+    ClassInfo->SetArena(&GetArena());
+
     ClassInfos[TypeIndex] = std::move(ClassInfo);
+
+    // 快照可能仍指向被替换的Info，此时必须立即发布
+    if (Replaced || bNameTaken)
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+        PublishLocked();
+        Reclaimer.Retire(std::move(Replaced));
+        Reclaimer.Collect();
+    }
+    else if (BatchDepth > 0)
+    {
+        // 批量作用域内的新类型在作用域结束时发布，派生类也在发布时才合并新注册的基类
+        bPendingPublish.store(true, std::memory_order_release);
+        Generation.fetch_add(1, std::memory_order_release);
+    }
+    else
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+        PublishLocked();
+    }
+}
+
+// 延迟注册Enum
+void ReflectionRegistry::RegisterLazyEnum(std::type_index TypeIndex, std::string_view Name, void (*Register)())
+{
+    std::lock_guard<std::mutex> Lock(LazyMutex);
+
+    const TypeId Id = GetOrCreateTypeId(TypeIndex);
+
+    // 同一类型只记录第一次注册
+    if (LazyEnums.find(Id) != LazyEnums.end())
+    {
+        return;
+    }
+
+    auto& TargetArena = GetArena();
+    auto  Entry = TargetArena.Create<LazyRegistration>(Id, TargetArena.StoreString(Name), Register, ActiveModule);
+
+    LazyEnumNames.emplace(Entry->Name, Entry.get());
+    LazyEnums.emplace(Id, std::move(Entry));
+
+    bHasLazyRegistrations.store(true, std::memory_order_release);
+}
+
+// 延迟注册Class
+void ReflectionRegistry::RegisterLazyClass(std::type_index TypeIndex, std::string_view Name, void (*Register)())
+{
+    std::lock_guard<std::mutex> Lock(LazyMutex);
+
+    const TypeId Id = GetOrCreateTypeId(TypeIndex);
+
+    // 同一类型只记录第一次注册
+    if (LazyClasses.find(Id) != LazyClasses.end())
+    {
+        return;
+    }
+
+    auto& TargetArena = GetArena();
+    auto  Entry = TargetArena.Create<LazyRegistration>(Id, TargetArena.StoreString(Name), Register, ActiveModule);
+
+    LazyClassNames.emplace(Entry->Name, Entry.get());
+    LazyClasses.emplace(Id, std::move(Entry));
+
+    bHasLazyRegistrations.store(true, std::memory_order_release);
 }
 
 // Remove Enum Info
 void ReflectionRegistry::RemoveEnum(std::type_index TypeIndex)
 {
-    EnumInfos.erase(TypeIndex);
+    WarnIfSealed("RemoveEnum", TypeIndex.name());
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+
+    if (auto Removed = ExtractEnumLocked(TypeIndex))
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+        PublishLocked();
+        Reclaimer.Retire(std::move(Removed));
+        Reclaimer.Collect();
+    }
 }
 
 // Remove Class Info
 void ReflectionRegistry::RemoveClass(std::type_index TypeIndex)
 {
-    ClassInfos.erase(TypeIndex);
+    WarnIfSealed("RemoveClass", TypeIndex.name());
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+
+    if (auto Removed = ExtractClassLocked(TypeIndex))
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+        PublishLocked();
+        Reclaimer.Retire(std::move(Removed));
+        Reclaimer.Collect();
+    }
 }
 
 // Get Enum Info by TypeIndex
 EnumTypeInfo* ReflectionRegistry::GetEnumInfo(std::type_index TypeIndex) const
 {
-    EnumTypeInfo* Result = nullptr;
+    return ReadSnapshotOrResolve([TypeIndex](const RegistrySnapshot& Current) { return Current.FindEnum(TypeIndex); },
+                                 [this, TypeIndex]() { return FindLazyEnum(FindTypeId(TypeIndex)); });
+}
 
-    const auto it = EnumInfos.find(TypeIndex);
+// Get Enum Info by TypeId
+EnumTypeInfo* ReflectionRegistry::GetEnumInfo(TypeId Id) const
+{
+    return ReadSnapshotOrResolve([Id](const RegistrySnapshot& Current) { return Current.FindEnum(Id); },
+                                 [this, Id]() { return FindLazyEnum(Id); });
+}
+
+// Get Enum Info by Name
+EnumTypeInfo* ReflectionRegistry::GetEnumInfoByName(std::string_view Name) const
+{
+    return ReadSnapshotOrResolve([Name](const RegistrySnapshot& Current) { return Current.FindEnumByName(Name); },
+                                 [this, Name]() { return FindLazyEnumByName(Name); });
+}
+
+// Get Class Info by TypeIndex
+ClassTypeInfo* ReflectionRegistry::GetClassInfo(std::type_index TypeIndex) const
+{
+    return ReadSnapshotOrResolve([TypeIndex](const RegistrySnapshot& Current) { return Current.FindClass(TypeIndex); },
+                                 [this, TypeIndex]() { return FindLazyClass(FindTypeId(TypeIndex)); });
+}
+
+// Get Class Info by TypeId
+ClassTypeInfo* ReflectionRegistry::GetClassInfo(TypeId Id) const
+{
+    return ReadSnapshotOrResolve([Id](const RegistrySnapshot& Current) { return Current.FindClass(Id); },
+                                 [this, Id]() { return FindLazyClass(Id); });
+}
+
+// Get Class Info by Name
+ClassTypeInfo* ReflectionRegistry::GetClassInfoByName(std::string_view Name) const
+{
+    return ReadSnapshotOrResolve([Name](const RegistrySnapshot& Current) { return Current.FindClassByName(Name); },
+                                 [this, Name]() { return FindLazyClassByName(Name); });
+}
+
+// 封存注册表
+void ReflectionRegistry::Seal()
+{
+    // 封存后的注册会触发查找表重建，因此先执行所有延迟注册
+    ResolveAllLazy();
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+
+    bSealed.store(true, std::memory_order_relaxed);
+
+    PublishLocked();
+}
+
+// 创建模块
+ModuleHandle ReflectionRegistry::CreateModule(std::string_view Name, size_t ArenaPageSize)
+{
+    std::lock_guard<std::mutex> Lock(ModuleMutex);
+
+    const ModuleHandle Result = NextModule++;
+    Modules.emplace(Result, std::make_unique<ReflectionModule>(Result, Name, ArenaPageSize));
+
+    return Result;
+}
+
+// 卸载模块
+void ReflectionRegistry::UnloadModule(ModuleHandle Module)
+{
+    std::unique_ptr<ReflectionModule> Record;
+
+    {
+        std::lock_guard<std::mutex> Lock(ModuleMutex);
+
+        const auto it = Modules.find(Module);
+
+        if (it != Modules.end())
+        {
+            Record = std::move(it->second);
+            Modules.erase(it);
+        }
+    }
 
-    if (it != EnumInfos.end())
+    if (!Record)
     {
-        Result = it->second.get();
+        std::cerr << "[NekiraReflect] UnloadModule(" << Module << ") called with an unknown module.\n";
+        return;
     }
 
-    return Result;
+    // 卸载后不再引用模块内std::type_info的TypeId
+    std::vector<TypeId> UnboundIds;
+
+    // 延迟注册项的注册函数位于模块内，必须一并移除
+    {
+        std::lock_guard<std::mutex> Lock(LazyMutex);
+
+        EraseModuleLazyRegistrations(LazyEnums, LazyEnumNames, Record.get(), UnboundIds);
+        EraseModuleLazyRegistrations(LazyClasses, LazyClassNames, Record.get(), UnboundIds);
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(WriteMutex);
+
+        WarnIfSealed("UnloadModule", Record->Name);
+
+        std::vector<ArenaPtr<EnumTypeInfo>>  RemovedEnums;
+        std::vector<ArenaPtr<ClassTypeInfo>> RemovedClasses;
+
+        // 只移除仍由该模块注册的Info，已被替换的Info在替换时已交给回收器
+        for (const auto& [TypeIndex, Info] : Record->Enums)
+        {
+            const auto it = EnumInfos.find(TypeIndex);
+
+            if (it != EnumInfos.end() && it->second.get() == Info)
+            {
+                CollectTypeIds(*Info, UnboundIds);
+                RemovedEnums.push_back(ExtractEnumLocked(TypeIndex));
+            }
+        }
+
+        for (const auto& [TypeIndex, Info] : Record->Classes)
+        {
+            const auto it = ClassInfos.find(TypeIndex);
+
+            if (it != ClassInfos.end() && it->second.get() == Info)
+            {
+                CollectTypeIds(*Info, UnboundIds);
+                RemovedClasses.push_back(ExtractClassLocked(TypeIndex));
+            }
+        }
+
+        // 所有类型一次发布
+        if (!RemovedEnums.empty() || !RemovedClasses.empty())
+        {
+            Generation.fetch_add(1, std::memory_order_release);
+            PublishLocked();
+        }
+
+        for (auto& Removed : RemovedEnums)
+        {
+            Reclaimer.Retire(std::move(Removed));
+        }
+
+        for (auto& Removed : RemovedClasses)
+        {
+            Reclaimer.Retire(std::move(Removed));
+        }
+    }
+
+    for (const TypeId Id : UnboundIds)
+    {
+        UnbindTypeId(Id);
+    }
+
+    // 等待所有读者离开并释放模块的TypeInfo，之后模块的内存池随Record一起释放
+    Reclaimer.Synchronize();
+}
+
+// 获取当前线程激活的模块
+ModuleHandle ReflectionRegistry::GetActiveModule() const
+{
+    return ActiveModule != nullptr ? ActiveModule->Handle : MainModule;
+}
+
+// 获取当前激活模块的元数据内存池
+MetadataArena& ReflectionRegistry::GetArena()
+{
+    return ActiveModule != nullptr ? ActiveModule->Arena : Arena;
+}
+
+// 查找模块
+ReflectionModule* ReflectionRegistry::FindModule(ModuleHandle Module) const
+{
+    std::lock_guard<std::mutex> Lock(ModuleMutex);
+
+    const auto it = Modules.find(Module);
+
+    return it != Modules.end() ? it->second.get() : nullptr;
+}
+
+// 将新注册的Enum Info记录到当前激活的模块中
+void ReflectionRegistry::TrackInActiveModuleLocked(EnumTypeInfo* EnumInfo)
+{
+    if (ActiveModule != nullptr)
+    {
+        ActiveModule->Enums.emplace_back(EnumInfo->GetTypeIndex(), EnumInfo);
+    }
+}
+
+// 将新注册的Class Info记录到当前激活的模块中
+void ReflectionRegistry::TrackInActiveModuleLocked(ClassTypeInfo* ClassInfo)
+{
+    if (ActiveModule != nullptr)
+    {
+        ActiveModule->Classes.emplace_back(ClassInfo->GetTypeIndex(), ClassInfo);
+    }
+}
+
+// 记录一次类型注册的统计
+void ReflectionRegistry::AddRegistrationRecord(RegistrationRecord Record)
+{
+    std::lock_guard<std::mutex> Lock(ProfileMutex);
+
+    RegistrationRecords.push_back(std::move(Record));
+}
+
+// 获取所有类型注册的统计
+std::vector<RegistrationRecord> ReflectionRegistry::GetRegistrationRecords() const
+{
+    std::lock_guard<std::mutex> Lock(ProfileMutex);
+
+    return RegistrationRecords;
+}
+
+// 清空类型注册的统计
+void ReflectionRegistry::ClearRegistrationRecords()
+{
+    std::lock_guard<std::mutex> Lock(ProfileMutex);
+
+    RegistrationRecords.clear();
+}
+
+// 封存后修改注册表时输出警告
+void ReflectionRegistry::WarnIfSealed(const char* Operation, std::string_view Name) const
+{
+    if (IsSealed())
+    {
+        std::cerr << "[NekiraReflect] " << Operation << "(" << Name
+                  << ") called on a sealed registry, the lookup tables will be rebuilt.\n";
+    }
+}
+
+// 查找延迟注册的Enum
+LazyRegistration* ReflectionRegistry::FindLazyEnum(TypeId Id) const
+{
+    return FindLazyIn(LazyMutex, LazyEnums, Id);
+}
+
+// 按名称查找延迟注册的Enum
+LazyRegistration* ReflectionRegistry::FindLazyEnumByName(std::string_view Name) const
+{
+    return FindLazyIn(LazyMutex, LazyEnumNames, Name);
+}
+
+// 查找延迟注册的Class
+LazyRegistration* ReflectionRegistry::FindLazyClass(TypeId Id) const
+{
+    return FindLazyIn(LazyMutex, LazyClasses, Id);
+}
+
+// 按名称查找延迟注册的Class
+LazyRegistration* ReflectionRegistry::FindLazyClassByName(std::string_view Name) const
+{
+    return FindLazyIn(LazyMutex, LazyClassNames, Name);
 }
 
-// Get Enum Info by Name(Would be slower)
-EnumTypeInfo* ReflectionRegistry::GetEnumInfoByName(const std::string& Name) const
+// 执行所有尚未执行的延迟注册
+void ReflectionRegistry::ResolveAllLazy()
 {
-    EnumTypeInfo* Result = nullptr;
+    std::vector<LazyRegistration*> Pending;
 
-    for (const auto& Pair : EnumInfos)
     {
-        if (Pair.second->GetName() == Name)
+        std::lock_guard<std::mutex> Lock(LazyMutex);
+
+        Pending.reserve(LazyEnums.size() + LazyClasses.size());
+
+        for (const auto& Pair : LazyEnums)
         {
-            Result = Pair.second.get();
-            break;
+            Pending.push_back(Pair.second.get());
+        }
+
+        for (const auto& Pair : LazyClasses)
+        {
+            Pending.push_back(Pair.second.get());
         }
     }
 
-    return Result;
+    // 注册函数会获取写锁，必须在锁外执行；所有延迟注册一次发布
+    ScopedRegistrationBatch Batch;
+
+    for (auto* Entry : Pending)
+    {
+        RunLazyRegistration(Entry);
+    }
 }
 
-// Get Class Info by TypeIndex
-ClassTypeInfo* ReflectionRegistry::GetClassInfo(std::type_index TypeIndex) const
+// 从写入端容器中取出Enum Info
+ArenaPtr<EnumTypeInfo> ReflectionRegistry::ExtractEnumLocked(std::type_index TypeIndex)
 {
-    ClassTypeInfo* Result = nullptr;
+    const auto it = EnumInfos.find(TypeIndex);
+
+    if (it == EnumInfos.end())
+    {
+        return nullptr;
+    }
+
+    // 仅当名称索引指向该类型时才移除
+    const auto NameIt = EnumNames.find(it->second->GetName());
+
+    if (NameIt != EnumNames.end() && NameIt->second == it->second.get())
+    {
+        EnumNames.erase(NameIt);
+    }
+
+    auto Result = std::move(it->second);
+    EnumInfos.erase(it);
 
+    return Result;
+}
+
+// 从写入端容器中取出Class Info
+ArenaPtr<ClassTypeInfo> ReflectionRegistry::ExtractClassLocked(std::type_index TypeIndex)
+{
     const auto it = ClassInfos.find(TypeIndex);
 
-    if (it != ClassInfos.end())
+    if (it == ClassInfos.end())
+    {
+        return nullptr;
+    }
+
+    // 仅当名称索引指向该类型时才移除
+    const auto NameIt = ClassNames.find(it->second->GetName());
+
+    if (NameIt != ClassNames.end() && NameIt->second == it->second.get())
     {
-        Result = it->second.get();
+        ClassNames.erase(NameIt);
     }
 
+    auto Result = std::move(it->second);
+    ClassInfos.erase(it);
+
     return Result;
 }
 
-// Get Class Info by Name(Would be slower)
-ClassTypeInfo* ReflectionRegistry::GetClassInfoByName(const std::string& Name) const
+// 根据写入端容器构建并发布新的快照
+void ReflectionRegistry::PublishLocked() const
 {
-    ClassTypeInfo* Result = nullptr;
+    auto NewSnapshot = std::make_unique<RegistrySnapshot>();
 
-    for (const auto& Pair : ClassInfos)
+    if (bSealed.load(std::memory_order_relaxed))
     {
-        if (Pair.second->GetName() == Name)
+        NewSnapshot->bSealed = NewSnapshot->SealedEnums.Build(EnumInfos) && NewSnapshot->SealedClasses.Build(ClassInfos)
+                            && NewSnapshot->SealedEnumNames.Build(EnumNames)
+                            && NewSnapshot->SealedClassNames.Build(ClassNames);
+
+        if (!NewSnapshot->bSealed)
         {
-            Result = Pair.second.get();
-            break;
+            std::cerr << "[NekiraReflect] Failed to build the sealed lookup tables (hash collision), "
+                         "falling back to hash maps.\n";
+
+            NewSnapshot = std::make_unique<RegistrySnapshot>();
         }
     }
 
-    return Result;
+    // 封存的快照只使用查找表，无需再构建哈希表
+    if (!NewSnapshot->bSealed)
+    {
+        BuildSnapshotMapsLocked(*NewSnapshot);
+    }
+
+    BuildSnapshotArraysLocked(*NewSnapshot);
+
+    // 在发布快照之前为基类变化的类发布新的成员表，查询到新快照的读者总能看到合并后的成员
+    const bool bRelinked = LinkClassesLocked(*NewSnapshot);
+
+    bPendingPublish.store(false, std::memory_order_relaxed);
+
+    // 发布后旧快照可能仍被读者持有，交由回收器延迟释放
+    std::unique_ptr<const RegistrySnapshot> OldSnapshot(
+        Snapshot.exchange(NewSnapshot.release(), std::memory_order_seq_cst));
+
+    // 成员表发布之后再使Generation变化，观察到新Generation的FieldHandle等缓存会按新的成员表重新校验
+    if (bRelinked)
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+    }
+
+    Reclaimer.Retire(std::move(OldSnapshot));
+    Reclaimer.Collect();
+}
+
+// 按基类优先的顺序合并所有有基类的类
+bool ReflectionRegistry::LinkClassesLocked(const RegistrySnapshot& NewSnapshot) const
+{
+    bool bRelinked = false;
+
+    std::unordered_set<const ClassTypeInfo*> Visited;
+
+    for (ClassTypeInfo* ClassInfo : NewSnapshot.ClassesById)
+    {
+        if (ClassInfo != nullptr && !ClassInfo->GetBaseClasses().empty())
+        {
+            bRelinked |= LinkClassLocked(*ClassInfo, NewSnapshot, Visited);
+        }
+    }
+
+    return bRelinked;
+}
+
+// 先合并基类，再以基类当前的成员表合并该类
+bool ReflectionRegistry::LinkClassLocked(ClassTypeInfo& ClassInfo, const RegistrySnapshot& NewSnapshot,
+                                         std::unordered_set<const ClassTypeInfo*>& Visited) const
+{
+    // 已处理或正在处理(错误的注册形成环)的类不再合并
+    if (!Visited.insert(&ClassInfo).second)
+    {
+        return false;
+    }
+
+    bool bRelinked = false;
+
+    std::vector<const ClassTypeInfo*> Bases;
+    Bases.reserve(ClassInfo.GetBaseClasses().size());
+
+    for (const auto& Base : ClassInfo.GetBaseClasses())
+    {
+        ClassTypeInfo* BaseInfo = NewSnapshot.FindClass(Base.Id);
+
+        if (BaseInfo != nullptr && !BaseInfo->GetBaseClasses().empty())
+        {
+            bRelinked |= LinkClassLocked(*BaseInfo, NewSnapshot, Visited);
+        }
+
+        Bases.push_back(BaseInfo);
+    }
+
+    return ClassInfo.LinkBaseClasses(Bases) || bRelinked;
+}
+
+// 发布批量作用域内尚未发布的注册
+void ReflectionRegistry::PublishPending() const
+{
+    if (!bPendingPublish.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+
+    if (bPendingPublish.load(std::memory_order_relaxed))
+    {
+        PublishLocked();
+    }
+}
+
+// 构建快照中以TypeId为下标的数组
+void ReflectionRegistry::BuildSnapshotArraysLocked(RegistrySnapshot& NewSnapshot) const
+{
+    FillById(EnumInfos, NewSnapshot.EnumsById);
+    FillById(ClassInfos, NewSnapshot.ClassesById);
+}
+
+// 将写入端容器复制为快照的哈希表
+void ReflectionRegistry::BuildSnapshotMapsLocked(RegistrySnapshot& NewSnapshot) const
+{
+    NewSnapshot.Enums.reserve(EnumInfos.size());
+    for (const auto& [TypeIndex, Info] : EnumInfos)
+    {
+        NewSnapshot.Enums.emplace(TypeIndex, Info.get());
+    }
+
+    NewSnapshot.Classes.reserve(ClassInfos.size());
+    for (const auto& [TypeIndex, Info] : ClassInfos)
+    {
+        NewSnapshot.Classes.emplace(TypeIndex, Info.get());
+    }
+
+    NewSnapshot.EnumNames.insert(EnumNames.begin(), EnumNames.end());
+    NewSnapshot.ClassNames.insert(ClassNames.begin(), ClassNames.end());
+}
+
+
+ScopedRegistrationBatch::ScopedRegistrationBatch()
+{
+    ++BatchDepth;
+}
+
+ScopedRegistrationBatch::~ScopedRegistrationBatch()
+{
+    if (--BatchDepth == 0)
+    {
+        ReflectionRegistry::Get().PublishPending();
+    }
+}
+
+ScopedReflectionModule::ScopedReflectionModule(ModuleHandle Module)
+{
+    ReflectionModule* Target = nullptr;
+
+    if (Module != MainModule)
+    {
+        Target = ReflectionRegistry::Get().FindModule(Module);
+
+        if (Target == nullptr)
+        {
+            std::cerr << "[NekiraReflect] ScopedReflectionModule(" << Module
+                      << ") called with an unknown module, types will be registered in the main module.\n";
+        }
+    }
+
+    Previous = SwapActiveModule(Target);
+}
+
+ScopedReflectionModule::~ScopedReflectionModule()
+{
+    SwapActiveModule(Previous);
 }
 
 } // namespace NekiraReflect
\ No newline at end of file
@@ -0,0 +1,143 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Registry/ReflectionRegistry.hpp>
+#include <Registry/RegistrationProfiler.hpp>
+#include <algorithm>
+#include <atomic>
+
+
+namespace NekiraReflect
+{
+
+// 当前设置的堆分配计数器
+static std::atomic<HeapAllocationCounter> HeapCounter{nullptr};
+
+// 读取堆分配计数，未设置计数器时返回0
+static size_t ReadHeapAllocations()
+{
+    const auto Counter = HeapCounter.load(std::memory_order_acquire);
+
+    return Counter != nullptr ? Counter() : 0;
+}
+
+// 设置堆分配计数器
+void SetHeapAllocationCounter(HeapAllocationCounter Counter)
+{
+    HeapCounter.store(Counter, std::memory_order_release);
+}
+
+RegistrationProfileScope::RegistrationProfileScope(std::string_view InName) : Name(InName)
+{
+    const auto ThreadStats = MetadataArena::GetThreadStatistics();
+
+    StartMetadataBytes = ThreadStats.BytesUsed;
+    StartMetadataAllocations = ThreadStats.AllocationCount;
+    StartHeapAllocations = ReadHeapAllocations();
+
+    // 最后记录起始时间，避免把上面的开销计入耗时
+    StartTime = std::chrono::steady_clock::now();
+}
+
+RegistrationProfileScope::~RegistrationProfileScope()
+{
+    const auto EndTime = std::chrono::steady_clock::now();
+    const auto EndHeapAllocations = ReadHeapAllocations();
+    const auto ThreadStats = MetadataArena::GetThreadStatistics();
+
+    RegistrationRecord Record;
+    Record.Name = std::string(Name);
+    Record.WallTimeNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(EndTime - StartTime).count());
+    Record.MetadataBytes = ThreadStats.BytesUsed - StartMetadataBytes;
+    Record.MetadataAllocations = ThreadStats.AllocationCount - StartMetadataAllocations;
+    Record.HeapAllocations = EndHeapAllocations - StartHeapAllocations;
+
+    ReflectionRegistry::Get().AddRegistrationRecord(std::move(Record));
+}
+
+// 写入JSON字符串，转义引号、反斜杠与控制字符
+static void WriteJsonString(std::ostream& Stream, std::string_view String)
+{
+    Stream << '"';
+
+    for (const char Char : String)
+    {
+        if (Char == '"' || Char == '\\')
+        {
+            Stream << '\\' << Char;
+        }
+        else if (static_cast<unsigned char>(Char) < 0x20)
+        {
+            Stream << ' ';
+        }
+        else
+        {
+            Stream << Char;
+        }
+    }
+
+    Stream << '"';
+}
+
+// 导出注册统计
+void DumpRegistrationProfile(std::ostream& Stream, ProfileDumpFormat Format)
+{
+    auto Records = ReflectionRegistry::Get().GetRegistrationRecords();
+
+    std::stable_sort(Records.begin(), Records.end(), [](const RegistrationRecord& A, const RegistrationRecord& B) {
+        return A.WallTimeNs > B.WallTimeNs;
+    });
+
+    if (Format == ProfileDumpFormat::CSV)
+    {
+        Stream << "Name,WallTimeNs,MetadataBytes,MetadataAllocations,HeapAllocations\n";
+
+        for (const auto& Record : Records)
+        {
+            Stream << Record.Name << ',' << Record.WallTimeNs << ',' << Record.MetadataBytes << ','
+                   << Record.MetadataAllocations << ',' << Record.HeapAllocations << '\n';
+        }
+
+        return;
+    }
+
+    Stream << "[\n";
+
+    for (size_t Index = 0; Index < Records.size(); ++Index)
+    {
+        const auto& Record = Records[Index];
+
+        Stream << "  {\"Name\": ";
+        WriteJsonString(Stream, Record.Name);
+        Stream << ", \"WallTimeNs\": " << Record.WallTimeNs << ", \"MetadataBytes\": " << Record.MetadataBytes
+               << ", \"MetadataAllocations\": " << Record.MetadataAllocations
+               << ", \"HeapAllocations\": " << Record.HeapAllocations << "}"
+               << (Index + 1 < Records.size() ? ",\n" : "\n");
+    }
+
+    Stream << "]\n";
+}
+
+} // namespace NekiraReflect
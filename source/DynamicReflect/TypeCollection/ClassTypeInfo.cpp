@@ -22,34 +22,82 @@
  * SOFTWARE.
  */
 
+#include <Registry/ReflectionRegistry.hpp>
 #include <TypeCollection/CoreType.hpp>
+#include <Utility/Utilities.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
 
 
 namespace NekiraReflect
 {
 
+namespace
+{
+
+// 线程内的成员路径缓存，命中时无需加锁
+// [INFO] Version为所属类的路径缓存版本，类的成员变化时递增，与注册表的Generation一同校验
+struct FieldPathCacheEntry
+{
+    const ClassTypeInfo* Owner = nullptr;
+    uint64_t             Generation = 0;
+    uint64_t             Version = 0;
+    std::string          Path;
+    FieldPath            Result;
+};
+
+constexpr size_t FieldPathCacheSize = 64;
+
+thread_local std::array<FieldPathCacheEntry, FieldPathCacheSize> ThreadFieldPathCache;
+
+} // namespace
+
 // Add a member variable
-void ClassTypeInfo::AddVariable(std::unique_ptr<MemberVarInfo> varInfo)
+void ClassTypeInfo::AddVariable(ArenaPtr<MemberVarInfo> varInfo)
 {
+    // 先擦除再插入，保证Key指向新成员信息的名称
     const auto name = varInfo->GetName();
-    Variables[name] = std::move(varInfo);
+    UntrackDirtyField(name);
+    EraseField(Declared, name);
+    Declared.Variables.erase(name);
+
+    InsertField(Declared, *varInfo);
+    TrackDirtyField(Declared, *varInfo);
+    Declared.Variables.emplace(name, std::move(varInfo));
+
+    ClearFieldPathCache();
 }
 
 // Add a member function
-void ClassTypeInfo::AddFunction(std::unique_ptr<MemberFuncInfo> funcInfo)
+void ClassTypeInfo::AddFunction(ArenaPtr<MemberFuncInfo> funcInfo)
 {
+    // 先擦除再插入，保证Key指向新成员信息的名称
     const auto name = funcInfo->GetName();
-    Functions[name] = std::move(funcInfo);
+    Declared.Functions.erase(name);
+    Declared.Functions.emplace(name, std::move(funcInfo));
+}
+
+// Remove a member variable by name
+void ClassTypeInfo::RemoveVariable(std::string_view name)
+{
+    UntrackDirtyField(name);
+    EraseField(Declared, name);
+    Declared.Variables.erase(name);
+
+    ClearFieldPathCache();
 }
 
 // Get a member variable by name
-MemberVarInfo* ClassTypeInfo::GetVariable(const std::string& name) const
+MemberVarInfo* ClassTypeInfo::GetVariable(std::string_view name) const
 {
     MemberVarInfo* Result = nullptr;
 
-    auto it = Variables.find(name);
+    const MemberTable& Table = GetMembers();
+
+    auto it = Table.Variables.find(name);
 
-    if (it != Variables.end())
+    if (it != Table.Variables.end())
     {
         Result = it->second.get();
     }
@@ -58,13 +106,15 @@ MemberVarInfo* ClassTypeInfo::GetVariable(const std::string& name) const
 }
 
 // Get a member function by name
-MemberFuncInfo* ClassTypeInfo::GetFunction(const std::string& name) const
+MemberFuncInfo* ClassTypeInfo::GetFunction(std::string_view name) const
 {
     MemberFuncInfo* Result = nullptr;
 
-    auto it = Functions.find(name);
+    const MemberTable& Table = GetMembers();
 
-    if (it != Functions.end())
+    auto it = Table.Functions.find(name);
+
+    if (it != Table.Functions.end())
     {
         Result = it->second.get();
     }
@@ -72,4 +122,556 @@ MemberFuncInfo* ClassTypeInfo::GetFunction(const std::string& name) const
     return Result;
 }
 
+// Whether this class is the given class or derives from it
+bool ClassTypeInfo::IsA(TypeId id) const
+{
+    if (id == GetTypeId())
+    {
+        return true;
+    }
+
+    const auto& Ancestors = GetMembers().Ancestors;
+
+    return std::binary_search(Ancestors.begin(), Ancestors.end(), id);
+}
+
+// Merge the members of the resolved direct bases
+bool ClassTypeInfo::LinkBaseClasses(std::span<const ClassTypeInfo* const> Bases)
+{
+    std::vector<LinkedBase> Resolved;
+    Resolved.reserve(Bases.size());
+
+    for (const ClassTypeInfo* BaseInfo : Bases)
+    {
+        Resolved.push_back({BaseInfo, BaseInfo != nullptr ? BaseInfo->LinkVersion : 0});
+    }
+
+    // 与上次合并时的基类及其成员表相同时保留当前发布的成员表
+    if (Resolved == LinkedBases)
+    {
+        return false;
+    }
+
+    LinkedBases = std::move(Resolved);
+
+    const bool bHasBase =
+        std::any_of(Bases.begin(), Bases.end(), [](const ClassTypeInfo* BaseInfo) { return BaseInfo != nullptr; });
+
+    // 基类均未注册反射且从未合并过时，本类自身的成员表即为完整的成员表
+    if (!bHasBase && Members.load(std::memory_order_relaxed) == &Declared)
+    {
+        return false;
+    }
+
+    const MemberTable* NewTable = &Declared;
+
+    if (bHasBase)
+    {
+        LinkedTables.push_back(BuildLinkedTable(Bases));
+        NewTable = LinkedTables.back().get();
+    }
+
+    // 新表构建完成后整体发布，读者看到的总是完整的旧表或新表
+    Members.store(NewTable, std::memory_order_release);
+    ++LinkVersion;
+
+    ClearFieldPathCache();
+
+    return true;
+}
+
+// 在新的成员表中合并本类与基类的成员
+ArenaPtr<ClassTypeInfo::MemberTable> ClassTypeInfo::BuildLinkedTable(std::span<const ClassTypeInfo* const> Bases) const
+{
+    // 合并时激活的可能是任意模块，新表与继承的成员分配在本类所属模块的内存池中，随模块一同释放
+    auto& Arena = OwnerArena != nullptr ? *OwnerArena : ReflectionRegistry::Get().GetMainArena();
+
+    auto Table = Arena.Create<MemberTable>();
+    Table->DirtySetOffset = Declared.DirtySetOffset;
+    Table->bDirtyTracked = Declared.bDirtyTracked;
+    Table->DirtyFields.assign(Declared.DirtyFields.size(), nullptr);
+
+    // 复制本类自身的成员，保持本类追踪时分配的脏标记下标，Declared中的成员信息不被修改
+    for (const auto& Field : Declared.Fields)
+    {
+        const MemberVarInfo& OwnVar = *Declared.Variables.at(Field.Name);
+
+        auto       Copy = Arena.CreateWithTrailingName<MemberVarInfo>(Field.Name, OwnVar, 0, MemberFlags::None);
+        const auto CopyName = Copy->GetName();
+
+        if (OwnVar.GetDirtyIndex() != MemberVarInfo::InvalidDirtyIndex)
+        {
+            Copy->SetDirtyTracking(OwnVar.GetDirtyIndex(), static_cast<uint16_t>(Table->DirtySetOffset));
+            Table->DirtyFields[OwnVar.GetDirtyIndex()] = Copy.get();
+        }
+
+        InsertField(*Table, *Copy);
+        Table->Variables.emplace(CopyName, std::move(Copy));
+    }
+
+    for (const auto& [name, funcInfo] : Declared.Functions)
+    {
+        auto       Copy = Arena.Create<MemberFuncInfo>(Arena.StoreString(name), *funcInfo, 0, MemberFlags::None);
+        const auto CopyName = Copy->GetName();
+        Table->Functions.emplace(CopyName, std::move(Copy));
+    }
+
+    for (size_t BaseIndex = 0; BaseIndex < BaseClasses.size() && BaseIndex < Bases.size(); ++BaseIndex)
+    {
+        const BaseClassInfo& Base = BaseClasses[BaseIndex];
+        const ClassTypeInfo* BaseInfo = Bases[BaseIndex];
+
+        // 未注册反射的基类无法合并
+        if (BaseInfo == nullptr)
+        {
+            continue;
+        }
+
+        // 基类先于本类合并，其当前发布的成员表已是扁平的
+        const MemberTable& BaseTable = BaseInfo->GetMembers();
+
+        Table->Ancestors.push_back(Base.Id);
+        Table->Ancestors.insert(Table->Ancestors.end(), BaseTable.Ancestors.begin(), BaseTable.Ancestors.end());
+
+        // 本类未启用追踪时沿用第一个启用追踪的基类的DirtyFieldSet，继承的成员保持基类中的下标，
+        // 使通过基类与派生类的反射信息写入同一对象时标记一致
+        const size_t BaseSetOffset = BaseTable.DirtySetOffset + Base.Offset;
+        const bool   bAdoptBaseTracking =
+            !Table->bDirtyTracked && BaseTable.bDirtyTracked && BaseSetOffset <= UINT16_MAX;
+
+        if (bAdoptBaseTracking)
+        {
+            Table->bDirtyTracked = true;
+            Table->DirtySetOffset = BaseSetOffset;
+            Table->DirtyFields.assign(BaseTable.DirtyFields.size(), nullptr);
+        }
+
+        // 派生类(或更靠前的基类)的同名成员隐藏该基类的成员，按偏移顺序合并使下标的分配是确定的
+        for (const auto& BaseField : BaseTable.Fields)
+        {
+            if (Table->Variables.find(BaseField.Name) != Table->Variables.end())
+            {
+                continue;
+            }
+
+            const MemberVarInfo& BaseVar = *BaseTable.Variables.at(BaseField.Name);
+
+            auto       Inherited = Arena.CreateWithTrailingName<MemberVarInfo>(BaseField.Name, BaseVar, Base.Offset);
+            const auto InheritedName = Inherited->GetName();
+
+            if (bAdoptBaseTracking && BaseVar.GetDirtyIndex() != MemberVarInfo::InvalidDirtyIndex)
+            {
+                Inherited->SetDirtyTracking(BaseVar.GetDirtyIndex(), static_cast<uint16_t>(Table->DirtySetOffset));
+                Table->DirtyFields[BaseVar.GetDirtyIndex()] = Inherited.get();
+            }
+            else
+            {
+                TrackDirtyField(*Table, *Inherited);
+            }
+
+            InsertField(*Table, *Inherited);
+            Table->Variables.emplace(InheritedName, std::move(Inherited));
+        }
+
+        for (const auto& [name, funcInfo] : BaseTable.Functions)
+        {
+            if (Table->Functions.find(name) == Table->Functions.end())
+            {
+                auto       Inherited = Arena.Create<MemberFuncInfo>(Arena.StoreString(name), *funcInfo, Base.Offset);
+                const auto InheritedName = Inherited->GetName();
+                Table->Functions.emplace(InheritedName, std::move(Inherited));
+            }
+        }
+    }
+
+    // 沿用基类的追踪时，本类自身的成员排在基类的成员之后
+    for (const auto& Field : Declared.Fields)
+    {
+        MemberVarInfo& VarInfo = *Table->Variables.at(Field.Name);
+
+        if (VarInfo.GetDirtyIndex() == MemberVarInfo::InvalidDirtyIndex)
+        {
+            TrackDirtyField(*Table, VarInfo);
+        }
+    }
+
+    std::sort(Table->Ancestors.begin(), Table->Ancestors.end());
+    Table->Ancestors.erase(std::unique(Table->Ancestors.begin(), Table->Ancestors.end()), Table->Ancestors.end());
+
+    return Table;
+}
+
+// 按偏移插入成员变量描述符
+void ClassTypeInfo::InsertField(MemberTable& Table, const MemberVarInfo& varInfo)
+{
+    FieldDescriptor Field;
+    Field.Name = varInfo.GetName();
+    Field.Offset = static_cast<uint32_t>(varInfo.GetOffset());
+    Field.Size = static_cast<uint32_t>(varInfo.GetSize());
+    Field.Id = varInfo.GetTypeId();
+    Field.Flags = varInfo.GetFlags();
+
+    // upper_bound保证相同偏移(如空成员)的描述符保持添加顺序
+    const auto ByOffset = [](uint32_t Offset, const FieldDescriptor& Other) { return Offset < Other.Offset; };
+    const auto Position = std::upper_bound(Table.Fields.begin(), Table.Fields.end(), Field.Offset, ByOffset);
+
+    Table.Fields.insert(Position, Field);
+
+    Table.bPlanValid.store(false, std::memory_order_relaxed);
+}
+
+// 移除指定名称的成员变量描述符
+void ClassTypeInfo::EraseField(MemberTable& Table, std::string_view name)
+{
+    std::erase_if(Table.Fields, [name](const FieldDescriptor& Field) { return Field.Name == name; });
+
+    Table.bPlanValid.store(false, std::memory_order_relaxed);
+}
+
+// Get a compiled member path
+FieldPath ClassTypeInfo::GetFieldPath(std::string_view path) const
+{
+    // 嵌套的类被替换或移除时Generation变化，缓存的偏移可能已失效
+    const uint64_t Generation = GetRegistryGeneration();
+    const uint64_t Version = FieldPathVersion.load(std::memory_order_acquire);
+
+    const size_t Hash = static_cast<size_t>(HashBytes(path.data(), path.size(), reinterpret_cast<uintptr_t>(this)));
+    auto&        Entry = ThreadFieldPathCache[Hash & (FieldPathCacheSize - 1)];
+
+    if (Entry.Owner == this && Entry.Generation == Generation && Entry.Version == Version && Entry.Path == path)
+    {
+        return Entry.Result;
+    }
+
+    FieldPath Result;
+    bool      bCached = false;
+
+    {
+        std::shared_lock<std::shared_mutex> Lock(FieldPathMutex);
+
+        const auto it = FieldPathCache.find(path);
+
+        if (it != FieldPathCache.end() && it->second.Generation == Generation)
+        {
+            Result = it->second.Path;
+            bCached = true;
+        }
+    }
+
+    if (!bCached)
+    {
+        Result = FieldPath::Compile(this, path);
+
+        // 编译失败的路径不缓存，其中的类型可能稍后才注册
+        if (!Result.IsValid())
+        {
+            return Result;
+        }
+
+        std::unique_lock<std::shared_mutex> Lock(FieldPathMutex);
+        FieldPathCache.insert_or_assign(std::string(path), CachedFieldPath{Result, Generation});
+    }
+
+    Entry.Owner = this;
+    Entry.Generation = Generation;
+    Entry.Version = Version;
+    Entry.Path.assign(path);
+    Entry.Result = Result;
+
+    return Result;
+}
+
+// 清空已编译的成员路径
+void ClassTypeInfo::ClearFieldPathCache()
+{
+    std::unique_lock<std::shared_mutex> Lock(FieldPathMutex);
+    FieldPathCache.clear();
+
+    // 使各线程缓存中属于本类的条目失效
+    FieldPathVersion.fetch_add(1, std::memory_order_release);
+}
+
+// Enable dirty-field tracking
+void ClassTypeInfo::EnableDirtyTracking(size_t dirtySetOffset)
+{
+    // [INFO] 偏移以16位保存在成员信息中，DirtyFieldSet应声明在类的前部
+    if (dirtySetOffset > UINT16_MAX)
+    {
+        std::cerr << "[NekiraReflect] Cannot track dirty fields of " << GetName()
+                  << ", the DirtyFieldSet member must lie within the first 65535 bytes of the object.\n";
+        return;
+    }
+
+    if (Declared.bDirtyTracked)
+    {
+        return;
+    }
+
+    Declared.bDirtyTracked = true;
+    Declared.DirtySetOffset = dirtySetOffset;
+
+    // 已添加的成员按偏移顺序分配下标
+    for (const auto& Field : Declared.Fields)
+    {
+        TrackDirtyField(Declared, *Declared.Variables.at(Field.Name));
+    }
+
+    // 已构建的对象计划与已编译的路径不包含新分配的下标
+    Declared.bPlanValid.store(false, std::memory_order_relaxed);
+    ClearFieldPathCache();
+}
+
+// 为成员变量分配脏标记下标
+void ClassTypeInfo::TrackDirtyField(MemberTable& Table, MemberVarInfo& varInfo) const
+{
+    if (!Table.bDirtyTracked)
+    {
+        return;
+    }
+
+    if (Table.DirtyFields.size() >= DirtyFieldSet::MaxFields)
+    {
+        std::cerr << "[NekiraReflect] Member " << varInfo.GetName() << " of " << GetName()
+                  << " is not dirty-tracked, a class can track at most " << DirtyFieldSet::MaxFields << " members.\n";
+        return;
+    }
+
+    varInfo.SetDirtyTracking(static_cast<uint16_t>(Table.DirtyFields.size()),
+                             static_cast<uint16_t>(Table.DirtySetOffset));
+    Table.DirtyFields.push_back(&varInfo);
+}
+
+// 停止追踪成员变量
+void ClassTypeInfo::UntrackDirtyField(std::string_view name)
+{
+    const auto it = Declared.Variables.find(name);
+
+    if (!Declared.bDirtyTracked || it == Declared.Variables.end())
+    {
+        return;
+    }
+
+    const uint16_t Index = it->second->GetDirtyIndex();
+
+    if (Index < Declared.DirtyFields.size() && Declared.DirtyFields[Index] == it->second.get())
+    {
+        Declared.DirtyFields[Index] = nullptr;
+    }
+}
+
+// 追加对象计划的一步
+// [INFO] 只合并首尾相接的成员，成员之间的空隙可能属于未反射的成员或填充字节，不能按字节处理
+void ClassTypeInfo::AppendObjectStep(std::vector<ObjectStep>& Steps, const FieldDescriptor& Field, const TypeOps* Ops)
+{
+    if (Ops == nullptr && !Steps.empty() && Steps.back().Ops == nullptr &&
+        Steps.back().Offset + Steps.back().Size == Field.Offset)
+    {
+        Steps.back().Size += Field.Size;
+    }
+    else
+    {
+        Steps.push_back(ObjectStep{Field.Offset, Field.Size, Ops});
+    }
+}
+
+// 获取成员表的对象计划
+// [INFO] 合并生成的成员表发布后不再修改，其对象计划构建一次后也不再变化
+const ClassTypeInfo::ObjectPlan& ClassTypeInfo::GetObjectPlan(const MemberTable& Table) const
+{
+    ObjectPlan& CachedObjectPlan = Table.Plan;
+
+    if (Table.bPlanValid.load(std::memory_order_acquire))
+    {
+        return CachedObjectPlan;
+    }
+
+    std::lock_guard<std::mutex> Lock(Table.PlanMutex);
+
+    if (Table.bPlanValid.load(std::memory_order_relaxed))
+    {
+        return CachedObjectPlan;
+    }
+
+    CachedObjectPlan.CopySteps.clear();
+    CachedObjectPlan.HashSteps.clear();
+    CachedObjectPlan.DirtyIndices.clear();
+
+    CachedObjectPlan.bCopyable = true;
+
+    for (const auto& Field : Table.Fields)
+    {
+        const MemberVarInfo* VarInfo = Table.Variables.at(Field.Name).get();
+        const TypeOps*       Ops = VarInfo->GetTypeOps();
+
+        if (!Ops->bTriviallyCopyable && Ops->Copy == nullptr)
+        {
+            CachedObjectPlan.bCopyable = false;
+        }
+
+        AppendObjectStep(CachedObjectPlan.CopySteps, Field, Ops->bTriviallyCopyable ? nullptr : Ops);
+
+        // 浮点数、指针与含填充字节的成员可以按字节复制，但不能按字节哈希与比较
+        // 类型不可哈希的成员记录其TypeId，调用时按已注册的类递归处理
+        if (Ops->Hash == nullptr)
+        {
+            CachedObjectPlan.HashSteps.push_back(ObjectStep{Field.Offset, Field.Size, Ops, Field.Id});
+        }
+        else
+        {
+            AppendObjectStep(CachedObjectPlan.HashSteps, Field, Ops->bUniqueBytes ? nullptr : Ops);
+        }
+
+        if (VarInfo->GetDirtyIndex() != MemberVarInfo::InvalidDirtyIndex)
+        {
+            CachedObjectPlan.DirtyIndices.push_back(VarInfo->GetDirtyIndex());
+        }
+    }
+
+    Table.bPlanValid.store(true, std::memory_order_release);
+
+    return CachedObjectPlan;
+}
+
+// Copy all reflected member variables from Src to Dst
+void ClassTypeInfo::CopyObject(void* Dst, const void* Src) const
+{
+    if (Dst == Src)
+    {
+        return;
+    }
+
+    auto*       DstBytes = static_cast<char*>(Dst);
+    const auto* SrcBytes = static_cast<const char*>(Src);
+
+    // 计划与DirtyFieldSet取自同一成员表
+    const MemberTable& Table = GetMembers();
+    const ObjectPlan&  Plan = GetObjectPlan(Table);
+
+    for (const auto& Step : Plan.CopySteps)
+    {
+        if (Step.Ops == nullptr)
+        {
+            std::memcpy(DstBytes + Step.Offset, SrcBytes + Step.Offset, Step.Size);
+        }
+        else if (Step.Ops->Copy != nullptr)
+        {
+            Step.Ops->Copy(DstBytes + Step.Offset, SrcBytes + Step.Offset);
+        }
+    }
+
+    if (DirtyFieldSet* DirtySet = Plan.DirtyIndices.empty() ? nullptr : GetDirtyFieldSet(Table, Dst))
+    {
+        for (const uint16_t Index : Plan.DirtyIndices)
+        {
+            DirtySet->Mark(Index);
+        }
+    }
+}
+
+// Compute a 64-bit hash of all reflected member variables
+// [INFO] 无法比较的成员不参与哈希，这类对象的Equals总是返回false，哈希仍与Equals一致
+uint64_t ClassTypeInfo::Hash(const void* Object, uint64_t Seed) const
+{
+    const auto* Bytes = static_cast<const char*>(Object);
+
+    uint64_t Result = Seed;
+
+    for (const auto& Step : GetObjectPlan(GetMembers()).HashSteps)
+    {
+        if (Step.Ops == nullptr)
+        {
+            Result = HashBytes(Bytes + Step.Offset, Step.Size, Result);
+        }
+        else if (Step.Ops->Hash != nullptr)
+        {
+            Result = Step.Ops->Hash(Bytes + Step.Offset, Result);
+        }
+        else if (const ClassTypeInfo* Nested = GetNestedClass(Step))
+        {
+            Result = Nested->Hash(Bytes + Step.Offset, Result);
+        }
+    }
+
+    return Result;
+}
+
+// Compare all reflected member variables of Lhs and Rhs
+bool ClassTypeInfo::Equals(const void* Lhs, const void* Rhs) const
+{
+    if (Lhs == Rhs)
+    {
+        return IsComparable();
+    }
+
+    const auto* LhsBytes = static_cast<const char*>(Lhs);
+    const auto* RhsBytes = static_cast<const char*>(Rhs);
+
+    for (const auto& Step : GetObjectPlan(GetMembers()).HashSteps)
+    {
+        if (Step.Ops == nullptr)
+        {
+            if (std::memcmp(LhsBytes + Step.Offset, RhsBytes + Step.Offset, Step.Size) != 0)
+            {
+                return false;
+            }
+        }
+        else if (Step.Ops->Equals != nullptr)
+        {
+            if (!Step.Ops->Equals(LhsBytes + Step.Offset, RhsBytes + Step.Offset))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            // 无法比较的成员使对象不相等，不能忽略
+            const ClassTypeInfo* Nested = GetNestedClass(Step);
+
+            if (Nested == nullptr || !Nested->Equals(LhsBytes + Step.Offset, RhsBytes + Step.Offset))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Whether every reflected member variable can be hashed and compared
+bool ClassTypeInfo::IsComparable() const
+{
+    for (const auto& Step : GetObjectPlan(GetMembers()).HashSteps)
+    {
+        if (Step.Ops != nullptr && Step.Ops->Hash == nullptr)
+        {
+            const ClassTypeInfo* Nested = GetNestedClass(Step);
+
+            if (Nested == nullptr || !Nested->IsComparable())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Whether every reflected member variable can be copied by CopyObject
+bool ClassTypeInfo::IsCopyable() const
+{
+    return GetObjectPlan(GetMembers()).bCopyable;
+}
+
+// 获取按字节与按类型都无法哈希的成员对应的已注册类，未注册时为nullptr
+// [INFO] 调用时才查找，成员的类型可以晚于本类注册
+const ClassTypeInfo* ClassTypeInfo::GetNestedClass(const ObjectStep& Step) const
+{
+    if (Step.NestedId == InvalidTypeId || Step.NestedId == GetTypeId())
+    {
+        return nullptr;
+    }
+
+    return GetNClass(Step.NestedId);
+}
+
 } // namespace NekiraReflect
\ No newline at end of file
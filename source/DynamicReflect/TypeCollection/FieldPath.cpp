@@ -0,0 +1,104 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <TypeCollection/CoreType.hpp>
+#include <TypeCollection/FieldPath.hpp>
+#include <Utility/Utilities.hpp>
+
+
+namespace NekiraReflect
+{
+
+// Compile a dotted member path against ClassInfo
+FieldPath FieldPath::Compile(const ClassTypeInfo* ClassInfo, std::string_view Path)
+{
+    FieldPath Result;
+
+    if (ClassInfo == nullptr)
+    {
+        return Result;
+    }
+
+    const ClassTypeInfo* Current = ClassInfo;
+
+    size_t Offset = 0;
+    TypeId Id = InvalidTypeId;
+    size_t Begin = 0;
+
+    while (true)
+    {
+        const size_t           End = Path.find('.', Begin);
+        const std::string_view Segment = Path.substr(Begin, End == std::string_view::npos ? End : End - Begin);
+
+        // 上一段的成员不是已注册反射的类，无法继续向下查找
+        if (Current == nullptr)
+        {
+            std::cerr << "[NekiraReflect] FieldPath " << Path << " of " << ClassInfo->GetName() << ": member before "
+                      << Segment << " is not a reflected class embedded by value.\n";
+            return Result;
+        }
+
+        const MemberVarInfo* VarInfo = Segment.empty() ? nullptr : Current->GetVariable(Segment);
+
+        if (VarInfo == nullptr)
+        {
+            std::cerr << "[NekiraReflect] FieldPath " << Path << " of " << ClassInfo->GetName() << ": "
+                      << Current->GetName() << " has no member " << Segment << ".\n";
+            return Result;
+        }
+
+        // 当前层对象启用脏成员追踪时记录该层的脏标记，Offset此时为当前层对象相对根对象的偏移
+        if (VarInfo->GetDirtyIndex() != MemberVarInfo::InvalidDirtyIndex)
+        {
+            if (Result.DirtyHopCount < MaxDirtyHops)
+            {
+                Result.DirtyHops[Result.DirtyHopCount++] = {
+                    static_cast<uint32_t>(Offset + VarInfo->GetDirtySetOffset()), VarInfo->GetDirtyIndex()};
+            }
+            else
+            {
+                std::cerr << "[NekiraReflect] FieldPath " << Path << " of " << ClassInfo->GetName()
+                          << ": only the first " << MaxDirtyHops << " dirty-tracked members are marked.\n";
+            }
+        }
+
+        Offset += VarInfo->GetOffset();
+        Id = VarInfo->GetTypeId();
+
+        if (End == std::string_view::npos)
+        {
+            break;
+        }
+
+        Current = GetNClass(Id);
+        Begin = End + 1;
+    }
+
+    Result.Offset = Offset;
+    Result.Id = Id;
+
+    return Result;
+}
+
+} // namespace NekiraReflect
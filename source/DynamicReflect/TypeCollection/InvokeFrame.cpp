@@ -0,0 +1,80 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <TypeCollection/CoreType.hpp>
+#include <iostream>
+
+
+namespace NekiraReflect
+{
+
+// 先按整个对象数组校验一次，再分块并行调用
+bool MemberFuncInfo::InvokeBatchParallel(const ObjectSpan& Objects, std::span<const ArgumentColumn> Arguments,
+                                         const ResultColumn& Results, const ParallelOptions& Options) const
+{
+    ObjectSpan Adjusted = Objects;
+    Adjusted.Data = static_cast<char*>(Objects.Data) + ObjectOffset;
+
+    const void*        Callable = GetCallable();
+    const InvokeStatus Status = BatchCall(Callable, Adjusted, 0, 0, Arguments, Results);
+
+    if (Status != InvokeStatus::Success)
+    {
+        ReportInvokeFailure(Status, Arguments.size());
+        return false;
+    }
+
+    WorkStealingPool::Get().ParallelFor(Objects.Count, Options,
+                                        [&](size_t Begin, size_t End)
+                                        { BatchCall(Callable, Adjusted, Begin, End, Arguments, Results); });
+
+    return true;
+}
+
+// 输出参数帧调用失败的原因
+void MemberFuncInfo::ReportInvokeFailure(InvokeStatus Status, size_t ArgumentCount) const
+{
+    std::cerr << "[NekiraReflect] Failed to invoke member function " << GetName() << ": ";
+
+    switch (Status)
+    {
+    case InvokeStatus::ArgumentCountMismatch:
+        std::cerr << "argument count mismatch (" << ArgumentCount << " given).\n";
+        break;
+    case InvokeStatus::ArgumentTypeMismatch:
+        std::cerr << "argument type mismatch.\n";
+        break;
+    case InvokeStatus::ResultTypeMismatch:
+        std::cerr << "result storage does not match the return type.\n";
+        break;
+    case InvokeStatus::ColumnSizeMismatch:
+        std::cerr << "an argument or result column is shorter than the object span.\n";
+        break;
+    default:
+        std::cerr << "unknown error.\n";
+        break;
+    }
+}
+
+} // namespace NekiraReflect
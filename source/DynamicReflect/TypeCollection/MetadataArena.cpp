@@ -0,0 +1,120 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <TypeCollection/MetadataArena.hpp>
+#include <cstdint>
+#include <cstring>
+
+
+namespace NekiraReflect
+{
+
+// 当前线程的累计分配统计
+static thread_local MetadataArena::Statistics ThreadStats;
+
+// 分配内存
+void* MetadataArena::Allocate(size_t Size, size_t Alignment)
+{
+    ++ThreadStats.AllocationCount;
+    ThreadStats.BytesUsed += Size;
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    ++Stats.AllocationCount;
+    Stats.BytesUsed += Size;
+
+    // 较大的分配使用独立的内存页，不打断当前页
+    if (Size + Alignment > PageSize / 4)
+    {
+        const size_t DedicatedSize = Size + Alignment;
+        Pages.emplace_back(new std::byte[DedicatedSize]);
+
+        ++Stats.PageCount;
+        Stats.BytesReserved += DedicatedSize;
+
+        void*  Memory = Pages.back().get();
+        size_t Space = DedicatedSize;
+
+        return std::align(Alignment, Size, Memory, Space);
+    }
+
+    void*  Memory = Cursor;
+    size_t Space = static_cast<size_t>(PageEnd - Cursor);
+
+    if (Cursor == nullptr || std::align(Alignment, Size, Memory, Space) == nullptr)
+    {
+        Pages.emplace_back(new std::byte[PageSize]);
+
+        ++Stats.PageCount;
+        Stats.BytesReserved += PageSize;
+
+        Memory = Pages.back().get();
+        Space = PageSize;
+        PageEnd = Pages.back().get() + PageSize;
+
+        std::align(Alignment, Size, Memory, Space);
+    }
+
+    Cursor = static_cast<std::byte*>(Memory) + Size;
+
+    return Memory;
+}
+
+// 将字符串复制到内存池中
+std::string_view MetadataArena::StoreString(std::string_view String)
+{
+    auto* Memory = static_cast<char*>(Allocate(String.size() + 1, alignof(char)));
+
+    std::memcpy(Memory, String.data(), String.size());
+    Memory[String.size()] = '\0';
+
+    return {Memory, String.size()};
+}
+
+// 一次性释放全部内存
+void MetadataArena::Release()
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    Pages.clear();
+    Cursor = nullptr;
+    PageEnd = nullptr;
+    Stats = Statistics{};
+}
+
+// 获取内存使用统计
+MetadataArena::Statistics MetadataArena::GetStatistics() const
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    return Stats;
+}
+
+// 获取当前线程的累计分配统计
+MetadataArena::Statistics MetadataArena::GetThreadStatistics()
+{
+    return ThreadStats;
+}
+
+} // namespace NekiraReflect
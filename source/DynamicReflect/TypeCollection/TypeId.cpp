@@ -0,0 +1,241 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <TypeCollection/TypeId.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace NekiraReflect
+{
+
+namespace
+{
+// TypeId -> std::type_index的只追加分块数组，读取无锁
+// [INFO] 块一经分配不再移动或释放，写者在发布Count之前写入槽位，读者先读Count再读槽位
+class TypeIndexChunks final
+{
+public:
+    static constexpr size_t ChunkSize = 1024;
+    static constexpr size_t MaxChunks = 4096;
+
+    ~TypeIndexChunks()
+    {
+        for (auto& Chunk : Chunks)
+        {
+            delete[] Chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    // 已分配的TypeId数量
+    inline size_t Size() const
+    {
+        return Count.load(std::memory_order_acquire);
+    }
+
+    // 读取槽位，Id须小于Size()
+    inline std::type_index Load(TypeId Id) const
+    {
+        const Slot* Chunk = Chunks[Id / ChunkSize].load(std::memory_order_acquire);
+        return Chunk[Id % ChunkSize].Index.load(std::memory_order_acquire);
+    }
+
+    // 改写已分配的槽位(需持有写锁)
+    inline void Store(TypeId Id, std::type_index TypeIndex)
+    {
+        Slot* Chunk = Chunks[Id / ChunkSize].load(std::memory_order_relaxed);
+        Chunk[Id % ChunkSize].Index.store(TypeIndex, std::memory_order_release);
+    }
+
+    // 追加一个槽位并返回其TypeId(需持有写锁)
+    TypeId Append(std::type_index TypeIndex)
+    {
+        const size_t Index = Count.load(std::memory_order_relaxed);
+
+        if (Index >= ChunkSize * MaxChunks)
+        {
+            std::cerr << "[NekiraReflect] Too many types, the TypeId table is full.\n";
+            std::abort();
+        }
+
+        auto& Chunk = Chunks[Index / ChunkSize];
+
+        if (Chunk.load(std::memory_order_relaxed) == nullptr)
+        {
+            Chunk.store(new Slot[ChunkSize], std::memory_order_release);
+        }
+
+        Chunk.load(std::memory_order_relaxed)[Index % ChunkSize].Index.store(TypeIndex, std::memory_order_relaxed);
+        Count.store(Index + 1, std::memory_order_release);
+
+        return static_cast<TypeId>(Index);
+    }
+
+private:
+    // std::type_index只包含一个指针，std::atomic<std::type_index>是无锁的
+    struct Slot
+    {
+        std::atomic<std::type_index> Index{std::type_index(typeid(void))};
+    };
+
+    std::atomic<Slot*>  Chunks[MaxChunks] = {};
+    std::atomic<size_t> Count{0};
+};
+
+// TypeId分配表，下标0保留给InvalidTypeId
+struct TypeIdTable
+{
+    TypeIdTable()
+    {
+        TypeIndices.Append(std::type_index(typeid(void)));
+    }
+
+    // Mutex保护Ids与UnboundIds；TypeIndices只在写锁内追加与改写，GetTypeIndexById读取时不加锁
+    std::shared_mutex                            Mutex;
+    std::unordered_map<std::type_index, TypeId> Ids;
+    TypeIndexChunks                              TypeIndices;
+
+    // 已解绑的TypeId，Key为解绑时std::type_info::name()返回的地址，同一个std::type_info再次出现时复用原来的TypeId
+    // [INFO] 地址只作为Key比较，不会解引用；模块卸载后地址可能被其他类型复用，命中时再比较保存的名称确认
+    struct UnboundId
+    {
+        TypeId      Id = InvalidTypeId;
+        std::string Name;
+    };
+
+    std::unordered_map<const void*, UnboundId> UnboundIds;
+
+    static TypeIdTable& Get()
+    {
+        static TypeIdTable Instance;
+        return Instance;
+    }
+};
+} // namespace
+
+// 获取std::type_index对应的TypeId，首次查询时分配
+TypeId GetOrCreateTypeId(std::type_index TypeIndex)
+{
+    auto& Table = TypeIdTable::Get();
+
+    {
+        std::shared_lock<std::shared_mutex> Lock(Table.Mutex);
+
+        const auto it = Table.Ids.find(TypeIndex);
+
+        if (it != Table.Ids.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> Lock(Table.Mutex);
+
+    const auto it = Table.Ids.find(TypeIndex);
+
+    if (it != Table.Ids.end())
+    {
+        return it->second;
+    }
+
+    // 模块重新加载后，同一类型沿用卸载前的TypeId，使其他模块缓存的TypeId保持有效
+    const auto UnboundIt = Table.UnboundIds.find(TypeIndex.name());
+
+    if (UnboundIt != Table.UnboundIds.end() && UnboundIt->second.Name == TypeIndex.name())
+    {
+        const TypeId Result = UnboundIt->second.Id;
+
+        Table.UnboundIds.erase(UnboundIt);
+        Table.Ids.emplace(TypeIndex, Result);
+        Table.TypeIndices.Store(Result, TypeIndex);
+
+        return Result;
+    }
+
+    const TypeId Result = Table.TypeIndices.Append(TypeIndex);
+
+    Table.Ids.emplace(TypeIndex, Result);
+
+    return Result;
+}
+
+// 查找std::type_index已分配的TypeId，不分配新的TypeId
+TypeId FindTypeId(std::type_index TypeIndex)
+{
+    auto& Table = TypeIdTable::Get();
+
+    std::shared_lock<std::shared_mutex> Lock(Table.Mutex);
+
+    const auto it = Table.Ids.find(TypeIndex);
+
+    return it != Table.Ids.end() ? it->second : InvalidTypeId;
+}
+
+// 解除TypeId与std::type_index的绑定
+void UnbindTypeId(TypeId Id)
+{
+    auto& Table = TypeIdTable::Get();
+
+    std::unique_lock<std::shared_mutex> Lock(Table.Mutex);
+
+    if (Id == InvalidTypeId || Id >= Table.TypeIndices.Size())
+    {
+        return;
+    }
+
+    const std::type_index TypeIndex = Table.TypeIndices.Load(Id);
+
+    if (Table.Ids.erase(TypeIndex) == 0)
+    {
+        return;
+    }
+
+    Table.UnboundIds.insert_or_assign(TypeIndex.name(), TypeIdTable::UnboundId{Id, TypeIndex.name()});
+    Table.TypeIndices.Store(Id, std::type_index(typeid(void)));
+}
+
+// 获取TypeId对应的std::type_index，无锁读取
+std::type_index GetTypeIndexById(TypeId Id)
+{
+    const auto& Table = TypeIdTable::Get();
+
+    return Id < Table.TypeIndices.Size() ? Table.TypeIndices.Load(Id) : std::type_index(typeid(void));
+}
+
+// 输出访问的类型与成员的类型不一致的错误并终止程序
+void ReportTypeMismatch(std::string_view MemberName, TypeId Expected, TypeId Actual)
+{
+    std::cerr << "[NekiraReflect] Member " << MemberName << " is accessed as " << GetTypeIndexById(Actual).name()
+              << " but registered as " << GetTypeIndexById(Expected).name() << ".\n";
+
+    std::abort();
+}
+
+} // namespace NekiraReflect
@@ -24,45 +24,182 @@
 
 #include <Registry/ReflectionRegistry.hpp>
 #include <Utility/Utilities.hpp>
+#include <array>
 
 
 
 namespace NekiraReflect
 {
 
+// Get the arena that owns all registered reflection metadata
+MetadataArena& GetMetadataArena()
+{
+    return ReflectionRegistry::Get().GetArena();
+}
+
 // Register Enum TypeInfo
-void RegisterEnumInfo(std::unique_ptr<EnumTypeInfo> EnumInfo)
+void RegisterEnumInfo(ArenaPtr<EnumTypeInfo> EnumInfo)
 {
     ReflectionRegistry::Get().RegisterEnum(std::move(EnumInfo));
 }
 
 // Register Class TypeInfo
-void RegisterClassInfo(std::unique_ptr<ClassTypeInfo> ClassInfo)
+void RegisterClassInfo(ArenaPtr<ClassTypeInfo> ClassInfo)
 {
     ReflectionRegistry::Get().RegisterClass(std::move(ClassInfo));
 }
 
+// Get the registry generation
+uint64_t GetRegistryGeneration()
+{
+    return ReflectionRegistry::Get().GetGeneration();
+}
+
+// Register Enum TypeInfo lazily
+void RegisterLazyEnumInfo(std::type_index TypeIndex, std::string_view Name, void (*Register)())
+{
+    ReflectionRegistry::Get().RegisterLazyEnum(TypeIndex, Name, Register);
+}
+
+// Register Class TypeInfo lazily
+void RegisterLazyClassInfo(std::type_index TypeIndex, std::string_view Name, void (*Register)())
+{
+    ReflectionRegistry::Get().RegisterLazyClass(TypeIndex, Name, Register);
+}
+
 } // namespace NekiraReflect
 
 
 namespace NekiraReflect
 {
+
+namespace
+{
+
+// 每个线程的直接映射查找缓存的条目数(必须为2的幂)
+constexpr size_t LookupCacheSize = 64;
+
+// 查找缓存条目，Info为空表示空条目
+// [INFO] 未找到的结果不会被缓存，尚未执行的延迟注册会在未命中时执行
+template <typename KeyType, typename InfoType>
+struct LookupCacheEntry
+{
+    KeyType   Key{};
+    InfoType* Info = nullptr;
+    uint64_t  Generation = 0;
+};
+
+template <typename KeyType, typename InfoType>
+using LookupCache = std::array<LookupCacheEntry<KeyType, InfoType>, LookupCacheSize>;
+
+// 当前线程的命中统计，只由本线程读写，无需原子操作
+thread_local LookupCacheStats ThreadLookupCacheStats;
+
+// 先查线程缓存，Generation一致时直接返回，否则查询注册表并更新缓存
+template <typename KeyType, typename InfoType, typename ResolveFunc>
+InfoType* CachedLookup(LookupCache<KeyType, InfoType>& Cache, KeyType Key, size_t Hash, ResolveFunc&& Resolve)
+{
+    auto& Registry = ReflectionRegistry::Get();
+
+    // 须在查询前读取Generation，查询期间发生的替换会使该条目在下次访问时失效
+    const uint64_t Generation = Registry.GetGeneration();
+
+    auto& Entry = Cache[Hash & (LookupCacheSize - 1)];
+
+    if (Entry.Info != nullptr && Entry.Key == Key && Entry.Generation == Generation)
+    {
+        ++ThreadLookupCacheStats.Hits;
+        return Entry.Info;
+    }
+
+    ++ThreadLookupCacheStats.Misses;
+
+    InfoType* Result = Resolve(Registry);
+
+    if (Result != nullptr)
+    {
+        Entry.Key = Key;
+        Entry.Info = Result;
+        Entry.Generation = Generation;
+    }
+
+    return Result;
+}
+
+// [INFO] type_index的哈希需要对类型名称做哈希，这里以name()返回的指针作为Key，
+// 同一类型在不同动态库中的name()指针可能不同，此时只会导致缓存未命中
+inline const char* GetCacheKey(std::type_index TypeIndex)
+{
+    return TypeIndex.name();
+}
+
+inline size_t GetCacheHash(const char* Key)
+{
+    const auto Address = reinterpret_cast<uintptr_t>(Key);
+    return static_cast<size_t>(Address ^ (Address >> 6));
+}
+
+thread_local LookupCache<const char*, EnumTypeInfo>  EnumCacheByIndex;
+thread_local LookupCache<TypeId, EnumTypeInfo>       EnumCacheById;
+thread_local LookupCache<const char*, ClassTypeInfo> ClassCacheByIndex;
+thread_local LookupCache<TypeId, ClassTypeInfo>      ClassCacheById;
+
+} // namespace
+
+// Get the lookup cache statistics of the calling thread
+LookupCacheStats GetLookupCacheStats()
+{
+    return ThreadLookupCacheStats;
+}
+
+// Reset the lookup cache statistics of the calling thread
+void ResetLookupCacheStats()
+{
+    ThreadLookupCacheStats = LookupCacheStats{};
+}
+
 // Get Enum TypeInfo by std::type_index
 EnumTypeInfo* GetNEnum(std::type_index TypeIndex)
 {
-    return ReflectionRegistry::Get().GetEnumInfo(TypeIndex);
+    const char* Key = GetCacheKey(TypeIndex);
+
+    return CachedLookup(EnumCacheByIndex, Key, GetCacheHash(Key),
+                        [TypeIndex](ReflectionRegistry& Registry) { return Registry.GetEnumInfo(TypeIndex); });
+}
+
+// Get Enum TypeInfo by TypeId
+EnumTypeInfo* GetNEnum(TypeId Id)
+{
+    return CachedLookup(EnumCacheById, Id, static_cast<size_t>(Id),
+                        [Id](ReflectionRegistry& Registry) { return Registry.GetEnumInfo(Id); });
 }
 
 // Get Class TypeInfo by std::type_index
 ClassTypeInfo* GetNClass(std::type_index TypeIndex)
 {
-    return ReflectionRegistry::Get().GetClassInfo(TypeIndex);
+    const char* Key = GetCacheKey(TypeIndex);
+
+    return CachedLookup(ClassCacheByIndex, Key, GetCacheHash(Key),
+                        [TypeIndex](ReflectionRegistry& Registry) { return Registry.GetClassInfo(TypeIndex); });
+}
+
+// Get Class TypeInfo by TypeId
+ClassTypeInfo* GetNClass(TypeId Id)
+{
+    return CachedLookup(ClassCacheById, Id, static_cast<size_t>(Id),
+                        [Id](ReflectionRegistry& Registry) { return Registry.GetClassInfo(Id); });
 }
 
 // Get Struct TypeInfo by std::type_index
 ClassTypeInfo* GetNStruct(std::type_index TypeIndex)
 {
-    return ReflectionRegistry::Get().GetClassInfo(TypeIndex);
+    return GetNClass(TypeIndex);
+}
+
+// Get Struct TypeInfo by TypeId
+ClassTypeInfo* GetNStruct(TypeId Id)
+{
+    return GetNClass(Id);
 }
 
 } // namespace NekiraReflect
\ No newline at end of file
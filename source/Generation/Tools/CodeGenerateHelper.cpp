@@ -95,16 +95,26 @@ void CodeGenerateHelper::GenerateClassCode(std::ofstream& Header, std::ofstream&
 
         if (ClassMeta.NameSpace.empty())
         {
-            // NEKIRA_REFLECT_CLASS_ACCESSOR_DECL(ClassName), 声明类的反射访问器特化(无命名空间)
-            Header << "NEKIRA_REFLECT_CLASS_ACCESSOR_DECL" << "(" << ClassMeta.Name << ")" << '\n';
+            // NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN(ClassName), 开始声明类的反射访问器特化(无命名空间)
+            Header << "NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN" << "(" << ClassMeta.Name << ")" << '\n';
         }
         else
         {
-            // NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_NS(NameSpace, ClassName), 声明类的反射访问器特化(有命名空间)
-            Header << "NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_NS" << "(" << ClassMeta.NameSpace << ", " << ClassMeta.Name
-                   << ")" << '\n';
+            // NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN_NS(NameSpace, ClassName), 开始声明类的反射访问器特化(有命名空间)
+            Header << "NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN_NS" << "(" << ClassMeta.NameSpace << ", "
+                   << ClassMeta.Name << ")" << '\n';
+        }
+
+        // NEKIRA_REFLECT_CLASS_ACCESSOR_SETTER(VarName), 声明写入成员并标记脏成员的setter
+        // [INFO] 未启用追踪的派生类可能使用基类的脏成员集合，因此为所有类的成员变量生成setter
+        for (const auto& VarMeta : ClassMeta.MemberVars)
+        {
+            Header << "NEKIRA_REFLECT_CLASS_ACCESSOR_SETTER" << "(" << VarMeta.Name << ")" << '\n';
         }
 
+        // NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END(), 结束声明类的反射访问器特化
+        Header << "NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END()" << '\n';
+
         GenerateIntervalLine(Header);
 
         // --源文件内容
@@ -113,6 +123,18 @@ void CodeGenerateHelper::GenerateClassCode(std::ofstream& Header, std::ofstream&
         // NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN(QualifiedName),定义类的反射访问器RegisterReflection()实现
         Source << "NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN" << "(" << ClassMeta.QualifiedName << ")" << '\n';
 
+        // NEKIRA_REFLECT_CLASS_ACCESSOR_BASE(BaseName), 注册类的基类
+        for (const auto& BaseName : ClassMeta.BaseClasses)
+        {
+            Source << "NEKIRA_REFLECT_CLASS_ACCESSOR_BASE" << "(" << BaseName << ")" << '\n';
+        }
+
+        // NEKIRA_REFLECT_CLASS_ACCESSOR_DIRTY(VarName), 启用脏成员追踪
+        if (!ClassMeta.DirtySetName.empty())
+        {
+            Source << "NEKIRA_REFLECT_CLASS_ACCESSOR_DIRTY" << "(" << ClassMeta.DirtySetName << ")" << '\n';
+        }
+
         // NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(VarName), 注册类成员变量
         for (const auto& VarMeta : ClassMeta.MemberVars)
         {
@@ -209,6 +209,15 @@ void CodeScanHelper::ProcessClassDecl(const CXCursor& Cursor, VisitorData* Data)
 // 处理成员变量的声明
 void CodeScanHelper::ProcessMemberVarDecl(const CXCursor& Cursor, ClassMetaInfo* ClassMeta)
 {
+    // DirtyFieldSet成员只用于启用脏成员追踪，不作为成员变量注册
+    if (CheckAttribute(Cursor, "NDirtyFields"))
+    {
+        CXString SetSpelling = clang_getCursorSpelling(Cursor);
+        ClassMeta->DirtySetName = clang_getCString(SetSpelling);
+        clang_disposeString(SetSpelling);
+        return;
+    }
+
     if (!CheckAttribute(Cursor, "NProperty"))
     {
         return;
@@ -254,6 +263,31 @@ void CodeScanHelper::ProcessMemberFuncDecl(const CXCursor& Cursor, ClassMetaInfo
     ClassMeta->MemberFuncs.push_back(std::move(FuncMeta));
 }
 
+// 处理基类声明
+void CodeScanHelper::ProcessBaseSpecifier(const CXCursor& Cursor, ClassMetaInfo* ClassMeta)
+{
+    // [INFO] 虚基类的指针调整量在运行时才能确定，非公有基类在反射访问器外无法转换，均不记录
+    if (clang_isVirtualBase(Cursor) != 0 || clang_getCXXAccessSpecifier(Cursor) != CX_CXXPublic)
+    {
+        return;
+    }
+
+    // 使用规范类型的名称，得到包含完整命名空间的限定名称
+    CXType      BaseType = clang_getCanonicalType(clang_getCursorType(Cursor));
+    CXString    BaseSpelling = clang_getTypeSpelling(BaseType);
+    std::string BaseName = clang_getCString(BaseSpelling);
+    clang_disposeString(BaseSpelling);
+
+    // 匿名命名空间中的类型无法在生成的源文件中引用
+    if (BaseName.find("(anonymous") != std::string::npos)
+    {
+        return;
+    }
+
+    // 添加到类的基类列表
+    ClassMeta->BaseClasses.push_back(std::move(BaseName));
+}
+
 // 成员访问回调(用于类和结构体)
 CXChildVisitResult CodeScanHelper::MemberVisitor(CXCursor Current, CXCursor Root, CXClientData ClientData)
 {
@@ -267,6 +301,10 @@ CXChildVisitResult CodeScanHelper::MemberVisitor(CXCursor Current, CXCursor Root
     {
         ProcessMemberFuncDecl(Current, ClassMeta);
     }
+    else if (Current.kind == CXCursor_CXXBaseSpecifier)
+    {
+        ProcessBaseSpecifier(Current, ClassMeta);
+    }
 
     // 继续遍历同级节点
     return CXChildVisit_Continue;
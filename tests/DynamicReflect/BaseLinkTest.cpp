@@ -0,0 +1,279 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+// 在派生类之后注册、替换或移除的基类会在发布时重新合并，继承的成员分配在派生类所属模块的内存池中
+namespace
+{
+struct LinkBase
+{
+    int   Health = 0;
+    float Armor = 0.0f;
+
+    int GetHealth() const
+    {
+        return Health;
+    }
+};
+
+struct LinkPadding
+{
+    double Pad = 0.0;
+};
+
+struct LinkDerived : LinkPadding, LinkBase
+{
+    int Level = 0;
+};
+
+struct PluginDerived : LinkBase
+{
+    int Charges = 0;
+};
+
+void RegisterDerived()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<LinkDerived>("LinkDerived");
+    ClassInfo->AddBaseClass(NekiraReflect::MakeBaseClassInfo<LinkDerived, LinkBase>());
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Level", &LinkDerived::Level));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+void RegisterBase(bool bWithArmor)
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<LinkBase>("LinkBase");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Health", &LinkBase::Health));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("GetHealth", &LinkBase::GetHealth));
+
+    if (bWithArmor)
+    {
+        ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Armor", &LinkBase::Armor));
+    }
+
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+void CheckLateBase()
+{
+    const auto* DerivedInfo = NekiraReflect::GetNClass<LinkDerived>();
+
+    NEKIRA_CHECK(DerivedInfo != nullptr);
+
+    if (DerivedInfo == nullptr)
+    {
+        return;
+    }
+
+    // 基类尚未注册
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Level") != nullptr);
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Health") == nullptr);
+    NEKIRA_CHECK(!DerivedInfo->IsA<LinkBase>());
+
+    // 之后注册的基类被合并
+    RegisterBase(false);
+
+    LinkDerived Object;
+    Object.Health = 5;
+
+    const auto* HealthInfo = DerivedInfo->GetVariable("Health");
+
+    NEKIRA_CHECK(HealthInfo != nullptr && HealthInfo->GetValue<int>(&Object) == 5);
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Armor") == nullptr);
+    NEKIRA_CHECK(DerivedInfo->IsA<LinkBase>());
+    NEKIRA_CHECK(DerivedInfo->GetFields().size() == 2);
+
+    // 替换基类后合并新的成员
+    RegisterBase(true);
+
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Armor") != nullptr);
+    NEKIRA_CHECK(DerivedInfo->GetFields().size() == 3);
+
+    // 移除基类后继承的成员随之移除，本类的成员保留
+    NekiraReflect::ReflectionRegistry::Get().RemoveClass(typeid(LinkBase));
+
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Health") == nullptr);
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Level") != nullptr);
+    NEKIRA_CHECK(!DerivedInfo->IsA<LinkBase>());
+    NEKIRA_CHECK(DerivedInfo->GetFields().size() == 1);
+
+    RegisterBase(true);
+}
+
+// 重新合并发布新的成员表，之前取得的继承成员信息与调用器仍然有效
+void CheckRetainedMembers()
+{
+    const auto* DerivedInfo = NekiraReflect::GetNClass<LinkDerived>();
+
+    NEKIRA_CHECK(DerivedInfo != nullptr);
+
+    if (DerivedInfo == nullptr)
+    {
+        return;
+    }
+
+    const auto* HealthInfo = DerivedInfo->GetVariable("Health");
+    const auto* LevelInfo = DerivedInfo->GetVariable("Level");
+
+    const NekiraReflect::TypedInvoker<int()> GetHealth(DerivedInfo, "GetHealth");
+
+    NEKIRA_CHECK(HealthInfo != nullptr && LevelInfo != nullptr && GetHealth.IsValid());
+
+    if (HealthInfo == nullptr || LevelInfo == nullptr || !GetHealth.IsValid())
+    {
+        return;
+    }
+
+    // 替换基类后派生类在注册时即重新合并，Generation随之变化
+    const uint64_t Generation = NekiraReflect::GetRegistryGeneration();
+
+    RegisterBase(true);
+
+    NEKIRA_CHECK(NekiraReflect::GetRegistryGeneration() != Generation);
+    NEKIRA_CHECK(DerivedInfo->GetVariable("Health") != HealthInfo);
+
+    LinkDerived Object;
+    Object.Health = 7;
+    Object.Level = 2;
+
+    NEKIRA_CHECK(HealthInfo->GetValue<int>(&Object) == 7);
+    NEKIRA_CHECK(LevelInfo->GetValue<int>(&Object) == 2);
+    NEKIRA_CHECK(GetHealth(&Object) == 7);
+}
+
+// 读者并发查询派生类时写者反复替换基类，读者看到的总是完整的成员表
+// [INFO] 以-fsanitize=thread构建时可检查成员表发布中的数据竞争
+void CheckConcurrentRelink()
+{
+    constexpr int ReaderCount = 4;
+    constexpr int RoundCount = 200;
+
+    const auto* DerivedInfo = NekiraReflect::GetNClass<LinkDerived>();
+
+    NEKIRA_CHECK(DerivedInfo != nullptr);
+
+    if (DerivedInfo == nullptr)
+    {
+        return;
+    }
+
+    std::atomic<bool> bDone{false};
+    std::atomic<int>  Failures{0};
+
+    std::vector<std::thread> Readers;
+
+    for (int Index = 0; Index < ReaderCount; ++Index)
+    {
+        Readers.emplace_back(
+            [DerivedInfo, &bDone, &Failures]()
+            {
+                LinkDerived Object;
+                Object.Health = 3;
+                Object.Level = 4;
+
+                while (!bDone.load(std::memory_order_relaxed))
+                {
+                    const auto* HealthInfo = DerivedInfo->GetVariable("Health");
+                    const auto* LevelInfo = DerivedInfo->GetVariable("Level");
+                    const auto  FieldCount = DerivedInfo->GetFields().size();
+
+                    LinkDerived Copy;
+                    DerivedInfo->CopyObject(&Copy, &Object);
+
+                    // 基类始终处于注册状态，只是有无Armor成员
+                    const bool bValid = HealthInfo != nullptr && HealthInfo->GetValue<int>(&Object) == 3
+                                     && LevelInfo != nullptr && LevelInfo->GetValue<int>(&Object) == 4
+                                     && DerivedInfo->IsA<LinkBase>() && (FieldCount == 2 || FieldCount == 3)
+                                     && Copy.Health == 3 && Copy.Level == 4;
+
+                    if (!bValid)
+                    {
+                        Failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+    }
+
+    for (int Round = 0; Round < RoundCount; ++Round)
+    {
+        RegisterBase(Round % 2 == 0);
+    }
+
+    bDone.store(true, std::memory_order_relaxed);
+
+    for (auto& Reader : Readers)
+    {
+        Reader.join();
+    }
+
+    NEKIRA_CHECK(Failures.load() == 0);
+
+    RegisterBase(true);
+}
+
+void CheckModuleArena()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    const NekiraReflect::ModuleHandle Module = Registry.CreateModule("LinkPlugin");
+
+    {
+        NekiraReflect::ScopedReflectionModule Scope(Module);
+
+        auto ClassInfo = NekiraReflect::MakeClassTypeInfo<PluginDerived>("PluginDerived");
+        ClassInfo->AddBaseClass(NekiraReflect::MakeBaseClassInfo<PluginDerived, LinkBase>());
+        ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Charges", &PluginDerived::Charges));
+        NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+    }
+
+    // 在主模块中首次查询，继承的成员仍分配在插件模块的内存池中
+    const size_t MainBytes = Registry.GetMainArena().GetStatistics().BytesUsed;
+    const auto*  PluginInfo = NekiraReflect::GetNClass<PluginDerived>();
+
+    NEKIRA_CHECK(PluginInfo != nullptr && PluginInfo->GetVariable("Health") != nullptr);
+    NEKIRA_CHECK(PluginInfo != nullptr && PluginInfo->GetFunction("Missing") == nullptr);
+    NEKIRA_CHECK(Registry.GetMainArena().GetStatistics().BytesUsed == MainBytes);
+
+    Registry.UnloadModule(Module);
+
+    NEKIRA_CHECK(Registry.GetClassInfoByName("PluginDerived") == nullptr);
+}
+} // namespace
+
+int main()
+{
+    RegisterDerived();
+    CheckLateBase();
+    CheckRetainedMembers();
+    CheckConcurrentRelink();
+    CheckModuleArena();
+
+    return NekiraTest::Finish();
+}
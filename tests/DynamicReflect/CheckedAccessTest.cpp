@@ -0,0 +1,163 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <csignal>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#define NEKIRA_TEST_HAS_FORK 1
+#else
+#define NEKIRA_TEST_HAS_FORK 0
+#endif
+
+
+// Try*访问在VarType不匹配时返回失败且不修改成员；定义NEKIRA_REFLECT_CHECKED_ACCESS时，校验的访问在不匹配时终止程序
+namespace
+{
+struct CheckedRecord
+{
+    int         Count = 7;
+    float       Ratio = 0.5f;
+    std::string Label = "label";
+};
+
+struct CheckedOuter
+{
+    CheckedRecord Inner;
+};
+
+void RegisterTypes()
+{
+    auto RecordInfo = NekiraReflect::MakeClassTypeInfo<CheckedRecord>("CheckedRecord");
+    RecordInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Count", &CheckedRecord::Count));
+    RecordInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Ratio", &CheckedRecord::Ratio));
+    RecordInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Label", &CheckedRecord::Label));
+    NekiraReflect::RegisterClassInfo(std::move(RecordInfo));
+
+    auto OuterInfo = NekiraReflect::MakeClassTypeInfo<CheckedOuter>("CheckedOuter");
+    OuterInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Inner", &CheckedOuter::Inner));
+    NekiraReflect::RegisterClassInfo(std::move(OuterInfo));
+}
+
+void CheckTryAccess()
+{
+    const auto* ClassInfo = NekiraReflect::ReflectionRegistry::Get().GetClassInfo<CheckedRecord>();
+    const auto* CountInfo = ClassInfo->GetVariable("Count");
+    const auto* LabelInfo = ClassInfo->GetVariable("Label");
+
+    CheckedRecord Record;
+
+    // 类型匹配
+    NEKIRA_CHECK(CountInfo->TryGetValue<int>(&Record) == &Record.Count);
+    NEKIRA_CHECK(CountInfo->TrySetValue(&Record, 9) && Record.Count == 9);
+
+    // 类型不匹配，包括大小相同的类型与const版本
+    NEKIRA_CHECK(CountInfo->TryGetValue<float>(&Record) == nullptr);
+    NEKIRA_CHECK(CountInfo->TryGetValue<unsigned int>(&Record) == nullptr);
+    NEKIRA_CHECK(CountInfo->TryGetValue<float>(static_cast<const void*>(&Record)) == nullptr);
+    NEKIRA_CHECK(LabelInfo->TryGetValue<const char*>(&Record) == nullptr);
+
+    NEKIRA_CHECK(!CountInfo->TrySetValue(&Record, 3.0f));
+    NEKIRA_CHECK(!LabelInfo->TrySetValue(&Record, 1));
+    NEKIRA_CHECK(Record.Count == 9 && Record.Label == "label");
+
+    // 路径访问
+    const auto* OuterInfo = NekiraReflect::ReflectionRegistry::Get().GetClassInfo<CheckedOuter>();
+    const auto  Path = OuterInfo->GetFieldPath("Inner.Ratio");
+
+    CheckedOuter Outer;
+
+    NEKIRA_CHECK(Path.TryGet<float>(&Outer) == &Outer.Inner.Ratio);
+    NEKIRA_CHECK(Path.TryGet<double>(&Outer) == nullptr);
+    NEKIRA_CHECK(Path.TryGet<int>(&Outer) == nullptr);
+}
+
+#if NEKIRA_TEST_HAS_FORK
+// 在子进程中执行Body，返回子进程是否因SIGABRT终止
+template <typename Body>
+bool AbortsInChild(Body&& Function)
+{
+    const pid_t Child = fork();
+
+    if (Child == 0)
+    {
+        Function();
+        _exit(0);
+    }
+
+    int Status = 0;
+    waitpid(Child, &Status, 0);
+
+    return WIFSIGNALED(Status) && WTERMSIG(Status) == SIGABRT;
+}
+#endif
+
+void CheckCheckedAccess()
+{
+#ifdef NEKIRA_REFLECT_CHECKED_ACCESS
+    NEKIRA_CHECK(NekiraReflect::bCheckedMemberAccess);
+#else
+    NEKIRA_CHECK(!NekiraReflect::bCheckedMemberAccess);
+#endif
+
+    if constexpr (NekiraReflect::bCheckedMemberAccess)
+    {
+#if NEKIRA_TEST_HAS_FORK
+        auto*       ClassInfo = NekiraReflect::ReflectionRegistry::Get().GetClassInfo<CheckedRecord>();
+        const auto* CountInfo = ClassInfo->GetVariable("Count");
+        const auto* OuterInfo = NekiraReflect::ReflectionRegistry::Get().GetClassInfo<CheckedOuter>();
+        const auto  Path = OuterInfo->GetFieldPath("Inner.Label");
+
+        CheckedRecord Record;
+        CheckedOuter  Outer;
+
+        // 匹配的访问不终止
+        NEKIRA_CHECK(!AbortsInChild([&]() { CountInfo->GetValue<int>(&Record) = 1; }));
+        NEKIRA_CHECK(!AbortsInChild([&]() { Path.Set(&Outer, std::string("other")); }));
+
+        // 不匹配的访问终止
+        NEKIRA_CHECK(AbortsInChild([&]() { static_cast<void>(CountInfo->GetValue<float>(&Record)); }));
+        NEKIRA_CHECK(AbortsInChild([&]() { CountInfo->SetValue(&Record, 2.0); }));
+        NEKIRA_CHECK(AbortsInChild([&]() { ClassInfo->SetVariableValue(&Record, "Ratio", 1); }));
+        NEKIRA_CHECK(AbortsInChild([&]() { static_cast<void>(Path.Get<int>(&Outer)); }));
+        NEKIRA_CHECK(AbortsInChild([&]() { Path.Set(&Outer, 3); }));
+#endif
+    }
+}
+} // namespace
+
+int main()
+{
+    RegisterTypes();
+
+    CheckTryAccess();
+    CheckCheckedAccess();
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,234 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Batch/FieldGatherScatter.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/FieldPath.hpp>
+#include <TestCommon.hpp>
+#include <string>
+#include <vector>
+
+
+// 与NekiraReflectTool为GeneratedPlayer生成的头文件相同：声明反射访问器及每个成员变量的setter
+NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_BEGIN(GeneratedPlayer)
+NEKIRA_REFLECT_CLASS_ACCESSOR_SETTER(Health)
+NEKIRA_REFLECT_CLASS_ACCESSOR_SETTER(Name)
+NEKIRA_REFLECT_CLASS_ACCESSOR_DECL_END()
+
+class GeneratedPlayer
+{
+    NEKIRA_REFLECT_BODY(GeneratedPlayer)
+
+public:
+    int GetHealth() const
+    {
+        return Health;
+    }
+
+    const NekiraReflect::DirtyFieldSet& GetDirtyFields() const
+    {
+        return Dirty;
+    }
+
+private:
+    NekiraReflect::DirtyFieldSet Dirty;
+
+    int         Health = 0;
+    std::string Name;
+};
+
+// 与生成的源文件相同
+NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN(GeneratedPlayer)
+NEKIRA_REFLECT_CLASS_ACCESSOR_DIRTY(Dirty)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(Health)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(Name)
+NEKIRA_REFLECT_CLASS_ACCESSOR_END()
+
+// 批量复制、嵌套路径写入与生成的setter同样标记脏成员
+namespace
+{
+struct DirtyTransform
+{
+    float                        X = 0.0f;
+    float                        Y = 0.0f;
+    NekiraReflect::DirtyFieldSet DirtyFields;
+};
+
+struct DirtyEntity
+{
+    int                          Health = 0;
+    std::string                  Name;
+    DirtyTransform               Transform;
+    NekiraReflect::DirtyFieldSet DirtyFields;
+};
+
+void RegisterTypes()
+{
+    auto TransformInfo = NekiraReflect::MakeClassTypeInfo<DirtyTransform>("DirtyTransform");
+    TransformInfo->EnableDirtyTracking(&DirtyTransform::DirtyFields);
+    TransformInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("X", &DirtyTransform::X));
+    TransformInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Y", &DirtyTransform::Y));
+    NekiraReflect::RegisterClassInfo(std::move(TransformInfo));
+
+    auto EntityInfo = NekiraReflect::MakeClassTypeInfo<DirtyEntity>("DirtyEntity");
+    EntityInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Health", &DirtyEntity::Health));
+    EntityInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &DirtyEntity::Name));
+    EntityInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Transform", &DirtyEntity::Transform));
+
+    // 构建对象计划后才启用追踪，之后的CopyObject仍须标记
+    DirtyEntity Warmup;
+    EntityInfo->CopyObject(&Warmup, &Warmup);
+    EntityInfo->EnableDirtyTracking(&DirtyEntity::DirtyFields);
+
+    NekiraReflect::RegisterClassInfo(std::move(EntityInfo));
+}
+
+void CheckCopyObject(const NekiraReflect::ClassTypeInfo* EntityInfo)
+{
+    DirtyEntity Src;
+    DirtyEntity Dst;
+    Src.Health = 7;
+    Src.Name = "copied";
+
+    EntityInfo->CopyObject(&Dst, &Src);
+
+    NEKIRA_CHECK(Dst.Health == 7 && Dst.Name == "copied");
+    NEKIRA_CHECK(Dst.DirtyFields.Count() == 3);
+    NEKIRA_CHECK(Dst.DirtyFields.IsDirty(EntityInfo->GetVariable("Health")->GetDirtyIndex()));
+    NEKIRA_CHECK(Dst.DirtyFields.IsDirty(EntityInfo->GetVariable("Name")->GetDirtyIndex()));
+    NEKIRA_CHECK(!Src.DirtyFields.Any());
+}
+
+void CheckBatch(const NekiraReflect::ClassTypeInfo* EntityInfo)
+{
+    const auto* HealthInfo = EntityInfo->GetVariable("Health");
+    const auto* NameInfo = EntityInfo->GetVariable("Name");
+
+    std::vector<DirtyEntity> Entities(5);
+    std::vector<DirtyEntity> Copies(5);
+    std::vector<int>         Healths{1, 2, 3, 4, 5};
+
+    // 可按字节复制的成员
+    NekiraReflect::ScatterField(NekiraReflect::MakeObjectSpan(Entities), HealthInfo, Healths.data());
+
+    for (const auto& Entity : Entities)
+    {
+        NEKIRA_CHECK(Entity.DirtyFields.IsDirty(HealthInfo->GetDirtyIndex()));
+        NEKIRA_CHECK(Entity.DirtyFields.Count() == 1);
+    }
+
+    // 须经复制赋值的成员
+    NekiraReflect::CopyField(NekiraReflect::MakeObjectSpan(Copies), NekiraReflect::MakeObjectSpan(Entities), NameInfo);
+    NekiraReflect::CopyField(NekiraReflect::MakeObjectSpan(Copies), NekiraReflect::MakeObjectSpan(Entities), HealthInfo);
+
+    for (size_t Index = 0; Index < Copies.size(); ++Index)
+    {
+        NEKIRA_CHECK(Copies[Index].Health == Healths[Index]);
+        NEKIRA_CHECK(Copies[Index].DirtyFields.IsDirty(NameInfo->GetDirtyIndex()));
+        NEKIRA_CHECK(Copies[Index].DirtyFields.IsDirty(HealthInfo->GetDirtyIndex()));
+        NEKIRA_CHECK(!Entities[Index].DirtyFields.IsDirty(NameInfo->GetDirtyIndex()));
+    }
+}
+
+void CheckFieldPath(const NekiraReflect::ClassTypeInfo* EntityInfo)
+{
+    const auto* TransformInfo = NekiraReflect::GetNClass<DirtyTransform>();
+    const auto  PathY = NekiraReflect::FieldPath::Compile(EntityInfo, "Transform.Y");
+
+    NEKIRA_CHECK(PathY.IsValid());
+
+    DirtyEntity Entity;
+    PathY.Set(&Entity, 2.5f);
+
+    // 根对象与嵌套对象各自标记被经过的成员
+    NEKIRA_CHECK(Entity.Transform.Y == 2.5f);
+    NEKIRA_CHECK(Entity.DirtyFields.Count() == 1);
+    NEKIRA_CHECK(Entity.DirtyFields.IsDirty(EntityInfo->GetVariable("Transform")->GetDirtyIndex()));
+    NEKIRA_CHECK(Entity.Transform.DirtyFields.Count() == 1);
+    NEKIRA_CHECK(Entity.Transform.DirtyFields.IsDirty(TransformInfo->GetVariable("Y")->GetDirtyIndex()));
+
+    // 经ClassTypeInfo缓存的路径同样标记
+    DirtyEntity Other;
+    EntityInfo->SetPathValue(&Other, "Transform.X", 1.0f);
+
+    NEKIRA_CHECK(Other.DirtyFields.IsDirty(EntityInfo->GetVariable("Transform")->GetDirtyIndex()));
+    NEKIRA_CHECK(Other.Transform.DirtyFields.IsDirty(TransformInfo->GetVariable("X")->GetDirtyIndex()));
+}
+
+// 生成的setter写入私有成员并标记脏成员
+void CheckGeneratedSetters()
+{
+    using Accessor = NekiraReflect::ReflectionAccessor<GeneratedPlayer>;
+
+    Accessor::RegisterReflection();
+
+    const auto* PlayerInfo = NekiraReflect::GetNClass<GeneratedPlayer>();
+
+    NEKIRA_CHECK(PlayerInfo != nullptr && PlayerInfo->IsDirtyTracked());
+
+    if (PlayerInfo == nullptr)
+    {
+        return;
+    }
+
+    GeneratedPlayer Player;
+    Accessor::SetHealth(Player, 42);
+
+    NEKIRA_CHECK(Player.GetHealth() == 42);
+    NEKIRA_CHECK(Player.GetDirtyFields().Count() == 1);
+    NEKIRA_CHECK(Player.GetDirtyFields().IsDirty(PlayerInfo->GetVariable("Health")->GetDirtyIndex()));
+
+    Accessor::SetName(Player, "generated");
+
+    NEKIRA_CHECK(PlayerInfo->GetVariableValue<std::string>(&Player, "Name") == "generated");
+    NEKIRA_CHECK(Player.GetDirtyFields().Count() == 2);
+
+    // 只枚举修改过的成员
+    size_t Visited = 0;
+    PlayerInfo->ForEachDirtyField(&Player, [&Visited](const NekiraReflect::MemberVarInfo&) { ++Visited; });
+    NEKIRA_CHECK(Visited == 2);
+}
+} // namespace
+
+int main()
+{
+    RegisterTypes();
+    CheckGeneratedSetters();
+
+    const auto* EntityInfo = NekiraReflect::GetNClass<DirtyEntity>();
+
+    NEKIRA_CHECK(EntityInfo != nullptr && EntityInfo->IsDirtyTracked());
+
+    if (EntityInfo == nullptr)
+    {
+        return NekiraTest::Finish();
+    }
+
+    CheckCopyObject(EntityInfo);
+    CheckBatch(EntityInfo);
+    CheckFieldPath(EntityInfo);
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,176 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <csignal>
+#include <cstddef>
+#include <string>
+#include <typeindex>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#define NEKIRA_TEST_HAS_FORK 1
+#else
+#define NEKIRA_TEST_HAS_FORK 0
+#endif
+
+
+// FieldHandle在所在类未变化时保持有效；所在类被替换或移除后IsCurrent()为false，Refresh()按新的布局重新解析
+namespace
+{
+struct HandleRecord
+{
+    int                          Primary = 1;
+    int                          Secondary = 2;
+    NekiraReflect::DirtyFieldSet DirtyFields;
+};
+
+struct UnrelatedRecord
+{
+    int Value = 0;
+};
+
+// 注册HandleRecord，"Value"指向Member
+void RegisterRecord(int HandleRecord::* Member)
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<HandleRecord>("HandleRecord");
+    ClassInfo->EnableDirtyTracking(&HandleRecord::DirtyFields);
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", Member));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+void CheckResolve()
+{
+    RegisterRecord(&HandleRecord::Primary);
+
+    const auto Field = NekiraReflect::MakeFieldHandle<int, HandleRecord>("Value");
+
+    NEKIRA_CHECK(Field.IsValid() && Field.IsCurrent());
+
+    HandleRecord Record;
+    NEKIRA_CHECK(Field.Get(&Record) == 1);
+
+    Field.Set(&Record, 5);
+    NEKIRA_CHECK(Record.Primary == 5 && Record.DirtyFields.IsDirty(0));
+
+    // 类型不匹配与不存在的成员
+    const auto Mismatched = NekiraReflect::MakeFieldHandle<float, HandleRecord>("Value");
+    const auto Missing = NekiraReflect::MakeFieldHandle<int, HandleRecord>("Missing");
+
+    NEKIRA_CHECK(!Mismatched.IsValid());
+    NEKIRA_CHECK(!Missing.IsCurrent());
+    NEKIRA_CHECK(!NekiraReflect::FieldHandle<int>().IsCurrent());
+}
+
+void CheckUnrelatedChange()
+{
+    const auto Field = NekiraReflect::MakeFieldHandle<int, HandleRecord>("Value");
+    const auto Generation = NekiraReflect::GetRegistryGeneration();
+
+    // 注册其他类型使Generation变化，但句柄仍然有效
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<UnrelatedRecord>("UnrelatedRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &UnrelatedRecord::Value));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+
+    NEKIRA_CHECK(NekiraReflect::GetRegistryGeneration() != Generation);
+    NEKIRA_CHECK(Field.IsCurrent());
+
+    // 复制的句柄状态相同
+    const auto Copied = Field;
+    NEKIRA_CHECK(Copied.IsCurrent() && Copied.GetOffset() == Field.GetOffset());
+}
+
+void CheckReplacedOwner()
+{
+    auto Field = NekiraReflect::MakeFieldHandle<int, HandleRecord>("Value");
+
+    // 同名成员改为指向另一个成员，偏移变化
+    RegisterRecord(&HandleRecord::Secondary);
+
+    NEKIRA_CHECK(!Field.IsCurrent());
+    NEKIRA_CHECK(Field.Refresh());
+    NEKIRA_CHECK(Field.IsCurrent());
+    NEKIRA_CHECK(Field.GetOffset() == offsetof(HandleRecord, Secondary));
+
+    HandleRecord Record;
+    NEKIRA_CHECK(Field.Get(&Record) == 2);
+}
+
+void CheckRemovedOwner()
+{
+    auto Field = NekiraReflect::MakeFieldHandle<int, HandleRecord>("Value");
+
+    NekiraReflect::ReflectionRegistry::Get().RemoveClass(std::type_index(typeid(HandleRecord)));
+
+    NEKIRA_CHECK(!Field.IsCurrent());
+    NEKIRA_CHECK(!Field.Refresh());
+    NEKIRA_CHECK(!Field.IsValid());
+
+    // 重新注册后可再次解析
+    RegisterRecord(&HandleRecord::Primary);
+
+    NEKIRA_CHECK(Field.Refresh());
+    NEKIRA_CHECK(Field.IsCurrent() && Field.GetOffset() == offsetof(HandleRecord, Primary));
+}
+
+void CheckStaleAccessAborts()
+{
+#if NEKIRA_TEST_HAS_FORK
+    if constexpr (NekiraReflect::bCheckedMemberAccess)
+    {
+        const auto Field = NekiraReflect::MakeFieldHandle<int, HandleRecord>("Value");
+
+        RegisterRecord(&HandleRecord::Secondary);
+
+        const pid_t Child = fork();
+
+        if (Child == 0)
+        {
+            HandleRecord Record;
+            Field.Set(&Record, 3);
+            _exit(0);
+        }
+
+        int Status = 0;
+        waitpid(Child, &Status, 0);
+
+        NEKIRA_CHECK(WIFSIGNALED(Status) && WTERMSIG(Status) == SIGABRT);
+    }
+#endif
+}
+} // namespace
+
+int main()
+{
+    CheckResolve();
+    CheckUnrelatedChange();
+    CheckReplacedOwner();
+    CheckRemovedOwner();
+    CheckStaleAccessAborts();
+
+    return NekiraTest::Finish();
+}
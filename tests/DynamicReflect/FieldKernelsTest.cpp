@@ -0,0 +1,335 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <NekiraReflect/DynamicReflect/Batch/FieldKernels.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+// 成员变量列的运算在标量与AVX2实现下都与逐元素的参考循环一致，覆盖多个收集块、不足一个向量的剩余元素与连续的列
+namespace
+{
+struct KernelEntity
+{
+    char     Tag = 0;
+    int32_t  I32 = 0;
+    uint32_t U32 = 0;
+    int64_t  I64 = 0;
+    uint64_t U64 = 0;
+    float    F32 = 0.0f;
+    double   F64 = 0.0;
+    int16_t  I16 = 0;
+};
+
+// 只有一个成员的对象，列本身是连续的
+struct DenseEntity
+{
+    float Value = 0.0f;
+};
+
+// 跨越多个收集块(4096字节)，且不是向量宽度的整数倍
+constexpr size_t EntityCount = 3001;
+
+void RegisterTypes()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<KernelEntity>("KernelEntity");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("I32", &KernelEntity::I32));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("U32", &KernelEntity::U32));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("I64", &KernelEntity::I64));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("U64", &KernelEntity::U64));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F32", &KernelEntity::F32));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("F64", &KernelEntity::F64));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("I16", &KernelEntity::I16));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+
+    auto DenseInfo = NekiraReflect::MakeClassTypeInfo<DenseEntity>("DenseEntity");
+    DenseInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &DenseEntity::Value));
+    NekiraReflect::RegisterClassInfo(std::move(DenseInfo));
+}
+
+// 正负交替、跨越有符号边界的确定性数据
+std::vector<KernelEntity> MakeEntities()
+{
+    std::vector<KernelEntity> Entities(EntityCount);
+
+    uint64_t State = 0x9E3779B97F4A7C15ULL;
+
+    for (size_t Index = 0; Index < EntityCount; ++Index)
+    {
+        State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        KernelEntity& Entity = Entities[Index];
+        Entity.I32 = static_cast<int32_t>(State >> 32);
+        Entity.U32 = static_cast<uint32_t>(State >> 16);
+        Entity.I64 = static_cast<int64_t>(State) >> 8;
+        Entity.U64 = State;
+        Entity.F32 = static_cast<float>(static_cast<int32_t>(State >> 40)) / 1024.0f;
+        Entity.F64 = static_cast<double>(static_cast<int64_t>(State)) / 1e12;
+        Entity.I16 = static_cast<int16_t>(State >> 48);
+    }
+
+    // 与第一个元素相等的值，以及NaN与-0.0
+    Entities[EntityCount - 1].I32 = Entities[0].I32;
+    Entities[EntityCount - 1].U64 = Entities[0].U64;
+    Entities[17].F32 = std::numeric_limits<float>::quiet_NaN();
+    Entities[18].F64 = std::numeric_limits<double>::quiet_NaN();
+    Entities[19].F32 = -0.0f;
+
+    return Entities;
+}
+
+template <typename ValueType, typename SumType>
+SumType ReferenceSum(const std::vector<KernelEntity>& Entities, ValueType KernelEntity::* Member)
+{
+    SumType Result = 0;
+
+    for (const KernelEntity& Entity : Entities)
+    {
+        Result += static_cast<SumType>(Entity.*Member);
+    }
+
+    return Result;
+}
+
+template <typename ValueType>
+std::pair<ValueType, ValueType> ReferenceMinMax(const std::vector<KernelEntity>& Entities,
+                                                ValueType KernelEntity::* Member)
+{
+    ValueType Min = Entities[0].*Member;
+    ValueType Max = Min;
+
+    for (const KernelEntity& Entity : Entities)
+    {
+        const ValueType Value = Entity.*Member;
+        Min = Value < Min ? Value : Min;
+        Max = Max < Value ? Value : Max;
+    }
+
+    return {Min, Max};
+}
+
+template <typename ValueType>
+size_t ReferenceCount(const std::vector<KernelEntity>& Entities, ValueType KernelEntity::* Member, ValueType Target)
+{
+    size_t Result = 0;
+
+    for (const KernelEntity& Entity : Entities)
+    {
+        Result += Entity.*Member == Target ? 1 : 0;
+    }
+
+    return Result;
+}
+
+// 整数列的和、最值与计数必须与参考结果完全相同
+template <typename ValueType>
+void CheckIntegerColumn(std::vector<KernelEntity>& Entities, ValueType KernelEntity::* Member, const char* Name)
+{
+    using SumType = NekiraReflect::FieldSumType<ValueType>;
+
+    const auto* VarInfo = NekiraReflect::GetNClass<KernelEntity>()->GetVariable(Name);
+    const auto  Column = NekiraReflect::FieldColumnView<const ValueType>(NekiraReflect::MakeObjectSpan(Entities), VarInfo);
+
+    NEKIRA_CHECK(Column.size() == EntityCount);
+    NEKIRA_CHECK(NekiraReflect::FieldSum(Column) == (ReferenceSum<ValueType, SumType>(Entities, Member)));
+
+    const auto MinMax = NekiraReflect::FieldMinMax(Column);
+    NEKIRA_CHECK(MinMax.has_value() && *MinMax == ReferenceMinMax(Entities, Member));
+
+    const ValueType Target = Entities[0].*Member;
+    NEKIRA_CHECK(NekiraReflect::FieldCount(Column, Target) == ReferenceCount(Entities, Member, Target));
+
+    const size_t Positive = NekiraReflect::FieldCountIf(Column, [](ValueType Value) { return Value > 0; });
+    size_t       Expected = 0;
+
+    for (const KernelEntity& Entity : Entities)
+    {
+        Expected += Entity.*Member > 0 ? 1 : 0;
+    }
+
+    NEKIRA_CHECK(Positive == Expected);
+}
+
+// 浮点数列的和只要求与参考结果足够接近，NaN不影响最值，与NaN比较的计数为0
+template <typename ValueType>
+void CheckFloatColumn(std::vector<KernelEntity>& Entities, ValueType KernelEntity::* Member, const char* Name,
+                      size_t NaNIndex)
+{
+    const auto* VarInfo = NekiraReflect::GetNClass<KernelEntity>()->GetVariable(Name);
+    const auto  Column = NekiraReflect::FieldColumnView<const ValueType>(NekiraReflect::MakeObjectSpan(Entities), VarInfo);
+
+    // 求和时跳过NaN以比较其余元素的和
+    const ValueType Saved = Entities[NaNIndex].*Member;
+    Entities[NaNIndex].*Member = 0;
+
+    double Expected = 0.0;
+    double Magnitude = 0.0;
+
+    for (const KernelEntity& Entity : Entities)
+    {
+        Expected += static_cast<double>(Entity.*Member);
+        Magnitude += std::fabs(static_cast<double>(Entity.*Member));
+    }
+
+    const double Sum = static_cast<double>(NekiraReflect::FieldSum(Column));
+    NEKIRA_CHECK(std::fabs(Sum - Expected) <= Magnitude * std::numeric_limits<ValueType>::epsilon() * 4);
+
+    Entities[NaNIndex].*Member = Saved;
+    NEKIRA_CHECK(std::isnan(NekiraReflect::FieldSum(Column)));
+
+    const auto MinMax = NekiraReflect::FieldMinMax(Column);
+    const auto Reference = ReferenceMinMax(Entities, Member);
+    NEKIRA_CHECK(MinMax.has_value() && MinMax->first == Reference.first && MinMax->second == Reference.second);
+
+    const ValueType Target = Entities[5].*Member;
+    NEKIRA_CHECK(NekiraReflect::FieldCount(Column, Target) == ReferenceCount(Entities, Member, Target));
+    NEKIRA_CHECK(NekiraReflect::FieldCount(Column, std::numeric_limits<ValueType>::quiet_NaN()) == 0);
+
+    // 第一个元素为NaN时与std::minmax_element一致，结果保持为NaN
+    const ValueType First = Entities[0].*Member;
+    Entities[0].*Member = std::numeric_limits<ValueType>::quiet_NaN();
+
+    const auto NaNFirst = NekiraReflect::FieldMinMax(Column);
+    NEKIRA_CHECK(NaNFirst.has_value() && std::isnan(NaNFirst->first) && std::isnan(NaNFirst->second));
+
+    Entities[0].*Member = First;
+}
+
+// 没有连续数组归约的类型使用标量循环，结果相同
+void CheckFallbackColumn(std::vector<KernelEntity>& Entities)
+{
+    const auto* VarInfo = NekiraReflect::GetNClass<KernelEntity>()->GetVariable("I16");
+    const auto  Column = NekiraReflect::FieldColumnView<const int16_t>(NekiraReflect::MakeObjectSpan(Entities), VarInfo);
+
+    NEKIRA_CHECK(NekiraReflect::FieldSum(Column) == (ReferenceSum<int16_t, int64_t>(Entities, &KernelEntity::I16)));
+
+    const auto MinMax = NekiraReflect::FieldMinMax(Column);
+    NEKIRA_CHECK(MinMax.has_value() && *MinMax == ReferenceMinMax(Entities, &KernelEntity::I16));
+}
+
+// 列本身连续时不经过收集，直接归约
+void CheckDenseColumn()
+{
+    std::vector<DenseEntity> Entities(EntityCount);
+
+    for (size_t Index = 0; Index < EntityCount; ++Index)
+    {
+        Entities[Index].Value = static_cast<float>(Index % 7);
+    }
+
+    const auto* VarInfo = NekiraReflect::GetNClass<DenseEntity>()->GetVariable("Value");
+    const auto  Column = NekiraReflect::FieldColumnView<const float>(NekiraReflect::MakeObjectSpan(Entities), VarInfo);
+
+    NEKIRA_CHECK(Column.GetStride() == sizeof(float));
+    NEKIRA_CHECK(NekiraReflect::FieldSum(Column) == 8998.0f);
+    NEKIRA_CHECK(NekiraReflect::FieldCount(Column, 6.0f) == 428);
+
+    const auto MinMax = NekiraReflect::FieldMinMax(Column);
+    NEKIRA_CHECK(MinMax.has_value() && MinMax->first == 0.0f && MinMax->second == 6.0f);
+}
+
+// 连续数组的归约在每个长度下都正确处理不足一个向量的剩余元素
+void CheckDenseTails()
+{
+    std::vector<int64_t> Values;
+
+    for (size_t Count = 0; Count < 40; ++Count)
+    {
+        int64_t Expected = 0;
+
+        for (size_t Index = 0; Index < Count; ++Index)
+        {
+            Expected += Values[Index];
+        }
+
+        NEKIRA_CHECK(NekiraReflect::DenseSum(Values.data(), Count) == Expected);
+
+        if (Count > 0)
+        {
+            int64_t Min = Values[0];
+            int64_t Max = Values[0];
+            NekiraReflect::DenseMinMax(Values.data() + 1, Count - 1, Min, Max);
+
+            const auto Reference = std::minmax_element(Values.begin(), Values.begin() + static_cast<std::ptrdiff_t>(Count));
+            NEKIRA_CHECK(Min == *Reference.first && Max == *Reference.second);
+        }
+
+        NEKIRA_CHECK(NekiraReflect::DenseCount(Values.data(), Count, int64_t{0}) == (Count > 0 ? 1u : 0u));
+
+        Values.push_back(Count % 2 == 0 ? static_cast<int64_t>(Count) * 3 : -static_cast<int64_t>(Count) * 3);
+    }
+
+    // Min与Max的初值不来自数组时也只分别向下、向上合并
+    const uint64_t Unsigned[5] = {5, 1ULL << 63, 7, 3, ~0ULL};
+    uint64_t       Min = std::numeric_limits<uint64_t>::max();
+    uint64_t       Max = 0;
+
+    NekiraReflect::DenseMinMax(Unsigned, 5, Min, Max);
+    NEKIRA_CHECK(Min == 3 && Max == ~0ULL);
+}
+
+void CheckKernels(std::vector<KernelEntity>& Entities)
+{
+    CheckIntegerColumn(Entities, &KernelEntity::I32, "I32");
+    CheckIntegerColumn(Entities, &KernelEntity::U32, "U32");
+    CheckIntegerColumn(Entities, &KernelEntity::I64, "I64");
+    CheckIntegerColumn(Entities, &KernelEntity::U64, "U64");
+    CheckFloatColumn(Entities, &KernelEntity::F32, "F32", 17);
+    CheckFloatColumn(Entities, &KernelEntity::F64, "F64", 18);
+    CheckFallbackColumn(Entities);
+    CheckDenseColumn();
+    CheckDenseTails();
+}
+} // namespace
+
+int main()
+{
+    RegisterTypes();
+
+    std::vector<KernelEntity> Entities = MakeEntities();
+
+    using NekiraReflect::BatchInstructionSet;
+
+    const BatchInstructionSet Supported = NekiraReflect::GetBatchInstructionSet();
+
+    for (const auto InstructionSet : {BatchInstructionSet::Scalar, BatchInstructionSet::AVX2})
+    {
+        if (InstructionSet == BatchInstructionSet::AVX2 && Supported != InstructionSet)
+        {
+            continue;
+        }
+
+        NekiraReflect::SetBatchInstructionSet(InstructionSet);
+        CheckKernels(Entities);
+    }
+
+    NekiraReflect::SetBatchInstructionSet(Supported);
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,272 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Batch/ObjectSpan.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+
+
+// 替换全局operator new并计数，检查参数帧调用、TypedInvoker与批量调用在稳定状态下不分配堆内存
+namespace
+{
+std::atomic<bool>   bCounting{false};
+std::atomic<size_t> AllocationCount{0};
+
+void* CountedAllocate(std::size_t Size, std::size_t Alignment)
+{
+    if (bCounting.load(std::memory_order_relaxed))
+    {
+        AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void* Memory = nullptr;
+
+    if (Alignment > alignof(std::max_align_t))
+    {
+        Memory = std::aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment);
+    }
+    else
+    {
+        Memory = std::malloc(Size == 0 ? 1 : Size);
+    }
+
+    return Memory;
+}
+
+// 释放CountedAllocate分配的内存，所有operator delete都经由此处调用std::free
+// [INFO] 不内联，否则编译器会在内联后把std::free与operator new配对并报告-Wmismatched-new-delete
+[[gnu::noinline]] void CountedRelease(void* Memory) noexcept
+{
+    std::free(Memory);
+}
+
+// 统计期间的分配次数
+template <typename Body>
+size_t CountAllocations(Body&& Function)
+{
+    AllocationCount.store(0, std::memory_order_relaxed);
+    bCounting.store(true, std::memory_order_relaxed);
+
+    Function();
+
+    bCounting.store(false, std::memory_order_relaxed);
+    return AllocationCount.load(std::memory_order_relaxed);
+}
+} // namespace
+
+void* operator new(std::size_t Size)
+{
+    if (void* Memory = CountedAllocate(Size, alignof(std::max_align_t)))
+    {
+        return Memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size)
+{
+    return ::operator new(Size);
+}
+
+void* operator new(std::size_t Size, std::align_val_t Alignment)
+{
+    if (void* Memory = CountedAllocate(Size, static_cast<std::size_t>(Alignment)))
+    {
+        return Memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size, std::align_val_t Alignment)
+{
+    return ::operator new(Size, Alignment);
+}
+
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(Size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(Size, alignof(std::max_align_t));
+}
+
+void operator delete(void* Memory) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete[](void* Memory) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete(void* Memory, std::size_t) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete[](void* Memory, std::size_t) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete(void* Memory, std::align_val_t) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete[](void* Memory, std::align_val_t) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete(void* Memory, std::size_t, std::align_val_t) noexcept
+{
+    CountedRelease(Memory);
+}
+
+void operator delete[](void* Memory, std::size_t, std::align_val_t) noexcept
+{
+    CountedRelease(Memory);
+}
+
+namespace
+{
+struct Counter
+{
+    int Total = 0;
+
+    int Add(int Lhs, int Rhs)
+    {
+        Total += Lhs + Rhs;
+        return Total;
+    }
+
+    size_t Measure(const std::string& Text) const
+    {
+        return Text.size() + static_cast<size_t>(Total);
+    }
+
+    void Reset()
+    {
+        Total = 0;
+    }
+};
+
+void RegisterCounter()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<Counter>("Counter");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Total", &Counter::Total));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("Add", &Counter::Add));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("Measure", &Counter::Measure));
+    ClassInfo->AddFunction(NekiraReflect::MakeMemberFuncInfo("Reset", &Counter::Reset));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+} // namespace
+
+int main()
+{
+    RegisterCounter();
+
+    // 替换的operator new确实生效
+    NEKIRA_CHECK(CountAllocations([] { ::operator delete(::operator new(16)); }) == 1);
+
+    const auto* ClassInfo = NekiraReflect::GetNClass<Counter>();
+
+    NEKIRA_CHECK(ClassInfo != nullptr);
+
+    if (ClassInfo == nullptr)
+    {
+        return NekiraTest::Finish();
+    }
+
+    const auto* AddInfo = ClassInfo->GetFunction("Add");
+    const auto* MeasureInfo = ClassInfo->GetFunction("Measure");
+    const auto* ResetInfo = ClassInfo->GetFunction("Reset");
+
+    const auto Add = NekiraReflect::MakeTypedInvoker<int(int, int), Counter>("Add");
+
+    const std::string Text = "a string long enough to live on the heap";
+
+    Counter              Object;
+    std::vector<Counter> Objects(8);
+    std::vector<int>     Lhs{1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<int>     Sums(Lhs.size());
+
+    int    Sum = 0;
+    size_t Length = 0;
+
+    // 预热：首次调用时解析TypeIdOf等函数内的静态变量
+    AddInfo->InvokeInto(&Object, Sum, 1, 2);
+    MeasureInfo->InvokeInto(&Object, Length, Text);
+    ResetInfo->InvokeWithFrame(&Object, NekiraReflect::ArgumentFrame<0>());
+    AddInfo->InvokeBatchInto(NekiraReflect::MakeObjectSpan(Objects), std::span(Sums),
+                             NekiraReflect::MakeArgumentColumn(std::span(Lhs)), 1);
+
+    const size_t FrameAllocations = CountAllocations([&] {
+        for (int Index = 0; Index < 1000; ++Index)
+        {
+            ResetInfo->InvokeWithFrame(&Object, NekiraReflect::ArgumentFrame<0>());
+            MeasureInfo->InvokeInto(&Object, Length, Text);
+            AddInfo->InvokeInto(&Object, Sum, Index, 1);
+            AddInfo->InvokeWithFrame(&Object, NekiraReflect::ArgumentFrame<2>(Index, Sum),
+                                     NekiraReflect::MakeResultRef(Sum));
+        }
+    });
+
+    NEKIRA_CHECK(FrameAllocations == 0);
+    NEKIRA_CHECK(Length == Text.size());
+
+    const size_t TypedAllocations = CountAllocations([&] {
+        for (int Index = 0; Index < 1000; ++Index)
+        {
+            Sum = Add(&Object, Index, 1);
+        }
+    });
+
+    NEKIRA_CHECK(TypedAllocations == 0);
+
+    const size_t BatchAllocations = CountAllocations([&] {
+        for (int Index = 0; Index < 100; ++Index)
+        {
+            AddInfo->InvokeBatchInto(NekiraReflect::MakeObjectSpan(Objects), std::span(Sums),
+                                     NekiraReflect::MakeArgumentColumn(std::span(Lhs)), Index);
+        }
+    });
+
+    NEKIRA_CHECK(BatchAllocations == 0);
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,133 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <typeindex>
+
+
+// 延迟注册的类型在首次查询时执行一次注册函数，之后的查询不再执行；未注册类型的查询不分配TypeId
+namespace
+{
+struct LazyRecord
+{
+    int   Value = 0;
+    float Scale = 0.0f;
+};
+
+enum class LazyMode
+{
+    Off,
+    On
+};
+
+struct NeverRegistered
+{
+    int Value = 0;
+};
+
+int ClassRegisterCount = 0;
+int EnumRegisterCount = 0;
+
+void RegisterLazyRecord()
+{
+    ++ClassRegisterCount;
+
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<LazyRecord>("LazyRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &LazyRecord::Value));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Scale", &LazyRecord::Scale));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+void RegisterLazyMode()
+{
+    ++EnumRegisterCount;
+
+    auto EnumInfo = NekiraReflect::MakeEnumTypeInfo<LazyMode>("LazyMode");
+    EnumInfo->AddEnumValue("Off", static_cast<int64_t>(LazyMode::Off));
+    EnumInfo->AddEnumValue("On", static_cast<int64_t>(LazyMode::On));
+    NekiraReflect::RegisterEnumInfo(std::move(EnumInfo));
+}
+
+void CheckClass(NekiraReflect::ReflectionRegistry& Registry)
+{
+    Registry.RegisterLazyClass(typeid(LazyRecord), "LazyRecord", &RegisterLazyRecord);
+
+    // 记录时不执行注册函数
+    NEKIRA_CHECK(ClassRegisterCount == 0);
+
+    const auto* ClassInfo = Registry.GetClassInfo(std::type_index(typeid(LazyRecord)));
+
+    NEKIRA_CHECK(ClassRegisterCount == 1);
+    NEKIRA_CHECK(ClassInfo != nullptr && ClassInfo->GetVariable("Scale") != nullptr);
+
+    // 之后按类型、TypeId或名称查询都不再执行
+    NEKIRA_CHECK(Registry.GetClassInfo(std::type_index(typeid(LazyRecord))) == ClassInfo);
+    NEKIRA_CHECK(Registry.GetClassInfo<LazyRecord>() == ClassInfo);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("LazyRecord") == ClassInfo);
+    NEKIRA_CHECK(ClassRegisterCount == 1);
+
+    // 重复记录同一类型被忽略
+    Registry.RegisterLazyClass(typeid(LazyRecord), "LazyRecord", &RegisterLazyRecord);
+    NEKIRA_CHECK(Registry.GetClassInfo<LazyRecord>() == ClassInfo);
+    NEKIRA_CHECK(ClassRegisterCount == 1);
+}
+
+void CheckEnumByName(NekiraReflect::ReflectionRegistry& Registry)
+{
+    Registry.RegisterLazyEnum(typeid(LazyMode), "LazyMode", &RegisterLazyMode);
+
+    NEKIRA_CHECK(EnumRegisterCount == 0);
+
+    // 首次查询按名称进行
+    const auto* EnumInfo = Registry.GetEnumInfoByName("LazyMode");
+
+    NEKIRA_CHECK(EnumRegisterCount == 1);
+    NEKIRA_CHECK(EnumInfo != nullptr);
+    NEKIRA_CHECK(Registry.GetEnumInfo<LazyMode>() == EnumInfo);
+    NEKIRA_CHECK(EnumRegisterCount == 1);
+}
+
+void CheckMissDoesNotAllocate(NekiraReflect::ReflectionRegistry& Registry)
+{
+    const std::type_index Unknown(typeid(NeverRegistered));
+
+    NEKIRA_CHECK(NekiraReflect::FindTypeId(Unknown) == NekiraReflect::InvalidTypeId);
+    NEKIRA_CHECK(Registry.GetClassInfo(Unknown) == nullptr);
+    NEKIRA_CHECK(Registry.GetEnumInfo(Unknown) == nullptr);
+    NEKIRA_CHECK(NekiraReflect::FindTypeId(Unknown) == NekiraReflect::InvalidTypeId);
+}
+} // namespace
+
+int main()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    CheckClass(Registry);
+    CheckEnumByName(Registry);
+    CheckMissDoesNotAllocate(Registry);
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,239 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <typeindex>
+
+
+// 每个反射成员变量的内存占用：内存池中的描述符与紧随其后的名称，加上堆上的名称索引节点(含桶数组)与FieldDescriptor
+namespace
+{
+// 替换全局operator new，在每块内存前记录大小，统计存活的堆字节数
+std::atomic<std::ptrdiff_t> LiveHeapBytes{0};
+
+// 记录大小的头部，保持返回地址的对齐
+constexpr std::size_t HeaderSize = alignof(std::max_align_t);
+
+void* TrackedAllocate(std::size_t Size, std::size_t Alignment)
+{
+    const std::size_t Header = std::max(HeaderSize, Alignment);
+    const std::size_t Total = (Header + Size + Header - 1) / Header * Header;
+
+    auto* Block = static_cast<std::byte*>(std::aligned_alloc(Header, Total));
+
+    if (Block == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::byte* Memory = Block + Header;
+
+    // 大小与头部长度保存在返回地址之前
+    reinterpret_cast<std::size_t*>(Memory)[-1] = Size;
+    reinterpret_cast<std::size_t*>(Memory)[-2] = Header;
+
+    LiveHeapBytes.fetch_add(static_cast<std::ptrdiff_t>(Size), std::memory_order_relaxed);
+
+    return Memory;
+}
+
+// 释放TrackedAllocate分配的内存，所有operator delete都经由此处调用std::free
+// [INFO] 不内联，否则编译器会在内联后把std::free与operator new配对并报告-Wmismatched-new-delete
+[[gnu::noinline]] void TrackedRelease(void* Memory) noexcept
+{
+    if (Memory == nullptr)
+    {
+        return;
+    }
+
+    const std::size_t Size = static_cast<std::size_t*>(Memory)[-1];
+    const std::size_t Header = static_cast<std::size_t*>(Memory)[-2];
+
+    LiveHeapBytes.fetch_sub(static_cast<std::ptrdiff_t>(Size), std::memory_order_relaxed);
+
+    std::free(static_cast<std::byte*>(Memory) - Header);
+}
+} // namespace
+
+void* operator new(std::size_t Size)
+{
+    if (void* Memory = TrackedAllocate(Size, HeaderSize))
+    {
+        return Memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size)
+{
+    return ::operator new(Size);
+}
+
+void* operator new(std::size_t Size, std::align_val_t Alignment)
+{
+    if (void* Memory = TrackedAllocate(Size, static_cast<std::size_t>(Alignment)))
+    {
+        return Memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size, std::align_val_t Alignment)
+{
+    return ::operator new(Size, Alignment);
+}
+
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept
+{
+    return TrackedAllocate(Size, HeaderSize);
+}
+
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept
+{
+    return TrackedAllocate(Size, HeaderSize);
+}
+
+void operator delete(void* Memory) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete[](void* Memory) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete(void* Memory, std::size_t) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete[](void* Memory, std::size_t) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete(void* Memory, std::align_val_t) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete[](void* Memory, std::align_val_t) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete(void* Memory, std::size_t, std::align_val_t) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+void operator delete[](void* Memory, std::size_t, std::align_val_t) noexcept
+{
+    TrackedRelease(Memory);
+}
+
+namespace
+{
+struct FootprintRecord
+{
+    int Value = 0;
+};
+
+// 注册的成员数量，名称为"F00"~"F63"，均指向同一个成员
+constexpr size_t MemberCount = 64;
+
+// 目标：描述符不超过24字节；描述符加名称的内存池占用不超过32字节；
+// 加上名称索引节点、桶数组与FieldDescriptor后，每个成员不超过128字节
+constexpr size_t DescriptorBudget = 24;
+constexpr size_t ArenaBudget = 32;
+constexpr size_t TotalBudget = 128;
+
+void CheckFootprint()
+{
+    static_assert(sizeof(NekiraReflect::MemberVarInfo) <= DescriptorBudget);
+    static_assert(sizeof(NekiraReflect::FieldDescriptor) <= 32);
+
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<FootprintRecord>("FootprintRecord");
+
+    // 名称在统计之前构造，不计入成员的占用
+    std::string Names[MemberCount];
+
+    for (size_t Index = 0; Index < MemberCount; ++Index)
+    {
+        Names[Index] = {'F', static_cast<char>('0' + Index / 10), static_cast<char>('0' + Index % 10)};
+    }
+
+    const auto ArenaBefore = NekiraReflect::MetadataArena::GetThreadStatistics();
+    const auto HeapBefore = LiveHeapBytes.load(std::memory_order_relaxed);
+
+    for (const auto& Name : Names)
+    {
+        ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo(Name, &FootprintRecord::Value));
+    }
+
+    const auto ArenaAfter = NekiraReflect::MetadataArena::GetThreadStatistics();
+    const auto HeapAfter = LiveHeapBytes.load(std::memory_order_relaxed);
+
+    NEKIRA_CHECK(ClassInfo->GetAllVariables().size() == MemberCount);
+    NEKIRA_CHECK(ClassInfo->GetFields().size() == MemberCount);
+
+    // 内存池：描述符与紧随其后的名称("Fxx\0")
+    const size_t ArenaPerMember = (ArenaAfter.BytesUsed - ArenaBefore.BytesUsed) / MemberCount;
+
+    NEKIRA_CHECK(ArenaPerMember == sizeof(NekiraReflect::MemberVarInfo) + 4);
+    NEKIRA_CHECK(ArenaPerMember <= ArenaBudget);
+
+    // 堆：名称索引的节点与桶数组、FieldDescriptor数组(含预留容量)
+    NEKIRA_CHECK(HeapAfter >= HeapBefore);
+
+    const size_t HeapPerMember = static_cast<size_t>(HeapAfter - HeapBefore) / MemberCount;
+
+    NEKIRA_CHECK(HeapPerMember >= sizeof(NekiraReflect::FieldDescriptor));
+    NEKIRA_CHECK(ArenaPerMember + HeapPerMember <= TotalBudget);
+
+    if (ArenaPerMember + HeapPerMember > TotalBudget)
+    {
+        std::fprintf(stderr, "per-member footprint: %zu arena + %zu heap bytes\n", ArenaPerMember, HeapPerMember);
+    }
+}
+} // namespace
+
+int main()
+{
+    CheckFootprint();
+
+    return NekiraTest::Finish();
+}
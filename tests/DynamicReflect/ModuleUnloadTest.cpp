@@ -0,0 +1,130 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <string>
+#include <typeindex>
+
+
+// 卸载模块只解绑模块自身注册的类型，主模块成员的类型(与模块共享)保持绑定
+namespace
+{
+struct MainRecord
+{
+    int         Value = 0;
+    std::string Name;
+    double      Weight = 0.0;
+};
+
+struct PluginRecord
+{
+    int         Value = 0;
+    std::string Name;
+};
+
+enum class PluginColor
+{
+    Red,
+    Green
+};
+
+void RegisterMainRecord()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<MainRecord>("MainRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &MainRecord::Value));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &MainRecord::Name));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Weight", &MainRecord::Weight));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+// 在模块中注册与主模块共享成员类型的类与枚举
+NekiraReflect::ModuleHandle LoadPlugin()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    const NekiraReflect::ModuleHandle Module = Registry.CreateModule("Plugin");
+
+    NekiraReflect::ScopedReflectionModule Scope(Module);
+
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<PluginRecord>("PluginRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &PluginRecord::Value));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &PluginRecord::Name));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+
+    auto EnumInfo = NekiraReflect::MakeEnumTypeInfo<PluginColor>("PluginColor");
+    EnumInfo->AddEnumValue("Red", static_cast<int64_t>(PluginColor::Red));
+    NekiraReflect::RegisterEnumInfo(std::move(EnumInfo));
+
+    return Module;
+}
+
+void CheckMainRecordTypes()
+{
+    const auto* ClassInfo = NekiraReflect::GetNClass<MainRecord>();
+
+    NEKIRA_CHECK(ClassInfo != nullptr);
+
+    if (ClassInfo == nullptr)
+    {
+        return;
+    }
+
+    NEKIRA_CHECK(ClassInfo->GetVariable("Value")->GetTypeIndex() == std::type_index(typeid(int)));
+    NEKIRA_CHECK(ClassInfo->GetVariable("Name")->GetTypeIndex() == std::type_index(typeid(std::string)));
+    NEKIRA_CHECK(ClassInfo->GetVariable("Weight")->GetTypeIndex() == std::type_index(typeid(double)));
+    NEKIRA_CHECK(ClassInfo->GetTypeIndex() == std::type_index(typeid(MainRecord)));
+}
+} // namespace
+
+int main()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    RegisterMainRecord();
+    CheckMainRecordTypes();
+
+    const NekiraReflect::TypeId PluginId = NekiraReflect::TypeIdOf<PluginRecord>();
+
+    for (int Round = 0; Round < 2; ++Round)
+    {
+        const NekiraReflect::ModuleHandle Module = LoadPlugin();
+
+        NEKIRA_CHECK(Registry.GetClassInfoByName("PluginRecord") != nullptr);
+        NEKIRA_CHECK(NekiraReflect::GetTypeIndexById(PluginId) == std::type_index(typeid(PluginRecord)));
+
+        Registry.UnloadModule(Module);
+
+        // 模块的类型被移除并解绑，共享的成员类型不受影响
+        NEKIRA_CHECK(Registry.GetClassInfoByName("PluginRecord") == nullptr);
+        NEKIRA_CHECK(Registry.GetEnumInfoByName("PluginColor") == nullptr);
+        NEKIRA_CHECK(NekiraReflect::GetTypeIndexById(PluginId) == std::type_index(typeid(void)));
+        NEKIRA_CHECK(NekiraReflect::GetTypeIndexById(NekiraReflect::TypeIdOf<int>()) == std::type_index(typeid(int)));
+
+        CheckMainRecordTypes();
+    }
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,302 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <NekiraReflect/DynamicReflect/TypeCollection/TypeOps.hpp>
+#include <TestCommon.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// 对象的哈希与比较按值进行：填充字节不参与，-0.0与0.0相等，NaN与NaN相等，值相等但缓冲区不同的对象相等；
+// 已反射的结构体成员递归比较，指针按地址比较，无法比较的成员使Equals返回false
+namespace
+{
+struct PaddedPair
+{
+    char Tag = 0;
+    int  Count = 0;
+};
+
+struct HashRecord
+{
+    char               Tag = 0;
+    int                Count = 0;
+    int                Total = 0;
+    double             Scale = 0.0;
+    std::string        Name;
+    std::vector<float> Weights;
+};
+
+// 含填充字节的成员结构体，注册反射后递归哈希与比较
+struct NestedRecord
+{
+    PaddedPair  Pair;
+    double      Ratio = 0.0;
+    const int*  Target = nullptr;
+};
+
+// 未注册反射的PaddedPair与无序容器都无法比较
+struct UncomparableRecord
+{
+    int                                  Id = 0;
+    PaddedPair                           Pair;
+    std::unordered_map<std::string, int> Lookup;
+};
+
+void RegisterTypes()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<HashRecord>("HashRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Tag", &HashRecord::Tag));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Count", &HashRecord::Count));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Total", &HashRecord::Total));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Scale", &HashRecord::Scale));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &HashRecord::Name));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Weights", &HashRecord::Weights));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+
+    auto NestedInfo = NekiraReflect::MakeClassTypeInfo<NestedRecord>("NestedRecord");
+    NestedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Pair", &NestedRecord::Pair));
+    NestedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Ratio", &NestedRecord::Ratio));
+    NestedInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Target", &NestedRecord::Target));
+    NekiraReflect::RegisterClassInfo(std::move(NestedInfo));
+
+    auto UncomparableInfo = NekiraReflect::MakeClassTypeInfo<UncomparableRecord>("UncomparableRecord");
+    UncomparableInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Id", &UncomparableRecord::Id));
+    UncomparableInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Pair", &UncomparableRecord::Pair));
+    UncomparableInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Lookup", &UncomparableRecord::Lookup));
+    NekiraReflect::RegisterClassInfo(std::move(UncomparableInfo));
+}
+
+// PaddedPair在使用它的类之后注册，调用时才查找成员的类
+void RegisterPaddedPair()
+{
+    auto PairInfo = NekiraReflect::MakeClassTypeInfo<PaddedPair>("PaddedPair");
+    PairInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Tag", &PaddedPair::Tag));
+    PairInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Count", &PaddedPair::Count));
+    NekiraReflect::RegisterClassInfo(std::move(PairInfo));
+}
+
+// 在填满指定字节的存储上构造对象，使两个对象的填充字节不同
+HashRecord* ConstructOver(void* Storage, unsigned char Fill)
+{
+    std::memset(Storage, Fill, sizeof(HashRecord));
+    auto* Record = new (Storage) HashRecord;
+    Record->Tag = 'x';
+    Record->Count = 3;
+    Record->Total = 42;
+    Record->Scale = 0.0;
+    Record->Name = "a string long enough to live on the heap";
+    Record->Weights = {0.5f, -0.0f, 2.0f};
+    return Record;
+}
+
+void CheckTypeOps()
+{
+    // 含填充字节的结构体、指针不可哈希，浮点数与其数组按值哈希
+    NEKIRA_CHECK(NekiraReflect::GetTypeOps<PaddedPair>()->bTriviallyCopyable);
+    NEKIRA_CHECK(!NekiraReflect::GetTypeOps<PaddedPair>()->bUniqueBytes);
+    NEKIRA_CHECK(NekiraReflect::GetTypeOps<PaddedPair>()->Hash == nullptr);
+    NEKIRA_CHECK(NekiraReflect::GetTypeOps<int*>()->Hash != nullptr);
+    NEKIRA_CHECK(!NekiraReflect::GetTypeOps<int*>()->bUniqueBytes);
+    NEKIRA_CHECK(!NekiraReflect::GetTypeOps<double>()->bUniqueBytes);
+    NEKIRA_CHECK(NekiraReflect::GetTypeOps<float[4]>()->Hash != nullptr);
+    NEKIRA_CHECK(NekiraReflect::GetTypeOps<int[4]>()->bUniqueBytes);
+
+    const double PositiveZero = 0.0;
+    const double NegativeZero = -0.0;
+    const auto*  DoubleOps = NekiraReflect::GetTypeOps<double>();
+
+    NEKIRA_CHECK(DoubleOps->Equals(&PositiveZero, &NegativeZero));
+    NEKIRA_CHECK(DoubleOps->Hash(&PositiveZero, 0) == DoubleOps->Hash(&NegativeZero, 0));
+
+    const std::vector<double> PositiveValues{1.0, 0.0};
+    const std::vector<double> NegativeValues{1.0, -0.0};
+    const auto*               VectorOps = NekiraReflect::GetTypeOps<std::vector<double>>();
+
+    NEKIRA_CHECK(VectorOps->Equals(&PositiveValues, &NegativeValues));
+    NEKIRA_CHECK(VectorOps->Hash(&PositiveValues, 0) == VectorOps->Hash(&NegativeValues, 0));
+
+    // NaN与NaN相等，与哈希一致
+    const double QuietNaN = std::numeric_limits<double>::quiet_NaN();
+    const double NegativeNaN = -std::nan("1");
+
+    NEKIRA_CHECK(DoubleOps->Equals(&QuietNaN, &NegativeNaN));
+    NEKIRA_CHECK(DoubleOps->Hash(&QuietNaN, 0) == DoubleOps->Hash(&NegativeNaN, 0));
+    NEKIRA_CHECK(!DoubleOps->Equals(&QuietNaN, &PositiveZero));
+
+    // 指针按地址比较，不比较指向的值
+    int        First = 1;
+    int        Second = 1;
+    const int* FirstPtr = &First;
+    const int* SamePtr = &First;
+    const int* SecondPtr = &Second;
+    const auto* PointerOps = NekiraReflect::GetTypeOps<const int*>();
+
+    NEKIRA_CHECK(PointerOps->Equals(&FirstPtr, &SamePtr));
+    NEKIRA_CHECK(PointerOps->Hash(&FirstPtr, 0) == PointerOps->Hash(&SamePtr, 0));
+    NEKIRA_CHECK(!PointerOps->Equals(&FirstPtr, &SecondPtr));
+}
+
+void CheckObjects()
+{
+    const auto* ClassInfo = NekiraReflect::GetNClass<HashRecord>();
+
+    NEKIRA_CHECK(ClassInfo != nullptr);
+
+    if (ClassInfo == nullptr)
+    {
+        return;
+    }
+
+    alignas(HashRecord) unsigned char LhsStorage[sizeof(HashRecord)];
+    alignas(HashRecord) unsigned char RhsStorage[sizeof(HashRecord)];
+
+    HashRecord* Lhs = ConstructOver(LhsStorage, 0x00);
+    HashRecord* Rhs = ConstructOver(RhsStorage, 0xFF);
+
+    // 填充字节不同、字符串与数组的缓冲区不同、-0.0与0.0不同的对象按值相等
+    Rhs->Scale = -0.0;
+    Rhs->Weights[1] = 0.0f;
+
+    NEKIRA_CHECK(Lhs->Name.data() != Rhs->Name.data());
+    NEKIRA_CHECK(ClassInfo->Equals(Lhs, Rhs));
+    NEKIRA_CHECK(ClassInfo->Hash(Lhs, 7) == ClassInfo->Hash(Rhs, 7));
+
+    Rhs->Total = 43;
+    NEKIRA_CHECK(!ClassInfo->Equals(Lhs, Rhs));
+    NEKIRA_CHECK(ClassInfo->Hash(Lhs, 7) != ClassInfo->Hash(Rhs, 7));
+
+    // 复制后按值相等
+    ClassInfo->CopyObject(Rhs, Lhs);
+    NEKIRA_CHECK(ClassInfo->Equals(Lhs, Rhs));
+    NEKIRA_CHECK(Rhs->Name == Lhs->Name && Rhs->Weights == Lhs->Weights);
+
+    Lhs->~HashRecord();
+    Rhs->~HashRecord();
+}
+
+// 成员结构体递归比较，指针与NaN按值比较
+void CheckNestedObjects()
+{
+    const auto* ClassInfo = NekiraReflect::GetNClass<NestedRecord>();
+
+    NEKIRA_CHECK(ClassInfo != nullptr);
+
+    if (ClassInfo == nullptr)
+    {
+        return;
+    }
+
+    // PaddedPair尚未注册时成员无法比较，对象不相等
+    NestedRecord Lhs;
+
+    NEKIRA_CHECK(!ClassInfo->IsComparable());
+    NEKIRA_CHECK(!ClassInfo->Equals(&Lhs, &Lhs));
+
+    RegisterPaddedPair();
+
+    NEKIRA_CHECK(ClassInfo->IsComparable());
+    NEKIRA_CHECK(ClassInfo->IsCopyable());
+
+    // 成员结构体的填充字节不同、NaN的位模式不同的对象相等
+    alignas(NestedRecord) unsigned char LhsStorage[sizeof(NestedRecord)];
+    alignas(NestedRecord) unsigned char RhsStorage[sizeof(NestedRecord)];
+    std::memset(LhsStorage, 0x00, sizeof(LhsStorage));
+    std::memset(RhsStorage, 0xFF, sizeof(RhsStorage));
+
+    const int Target = 5;
+
+    auto* Left = new (LhsStorage) NestedRecord;
+    auto* Right = new (RhsStorage) NestedRecord;
+
+    for (NestedRecord* Record : {Left, Right})
+    {
+        Record->Pair.Tag = 'p';
+        Record->Pair.Count = 9;
+        Record->Target = &Target;
+    }
+
+    Left->Ratio = std::numeric_limits<double>::quiet_NaN();
+    Right->Ratio = -std::nan("2");
+
+    NEKIRA_CHECK(ClassInfo->Equals(Left, Right));
+    NEKIRA_CHECK(ClassInfo->Hash(Left, 3) == ClassInfo->Hash(Right, 3));
+
+    Right->Pair.Count = 10;
+    NEKIRA_CHECK(!ClassInfo->Equals(Left, Right));
+    NEKIRA_CHECK(ClassInfo->Hash(Left, 3) != ClassInfo->Hash(Right, 3));
+
+    // 指向值相等的不同对象的指针不相等
+    const int OtherTarget = 5;
+
+    Right->Pair.Count = 9;
+    Right->Target = &OtherTarget;
+    NEKIRA_CHECK(!ClassInfo->Equals(Left, Right));
+    NEKIRA_CHECK(ClassInfo->Hash(Left, 3) != ClassInfo->Hash(Right, 3));
+}
+
+// 无法比较的成员不会被忽略，Equals总是返回false
+void CheckUncomparableObjects()
+{
+    const auto* ClassInfo = NekiraReflect::GetNClass<UncomparableRecord>();
+
+    NEKIRA_CHECK(ClassInfo != nullptr);
+
+    if (ClassInfo == nullptr)
+    {
+        return;
+    }
+
+    UncomparableRecord Lhs;
+    UncomparableRecord Rhs;
+    Lhs.Lookup["a"] = 1;
+
+    NEKIRA_CHECK(!ClassInfo->IsComparable());
+    NEKIRA_CHECK(ClassInfo->IsCopyable());
+    NEKIRA_CHECK(!ClassInfo->Equals(&Lhs, &Rhs));
+    NEKIRA_CHECK(!ClassInfo->Equals(&Lhs, &Lhs));
+
+    // 复制不受影响
+    ClassInfo->CopyObject(&Rhs, &Lhs);
+    NEKIRA_CHECK(Rhs.Lookup.size() == 1);
+}
+} // namespace
+
+int main()
+{
+    RegisterTypes();
+    CheckTypeOps();
+    CheckObjects();
+    CheckNestedObjects();
+    CheckUncomparableObjects();
+
+    return NekiraTest::Finish();
+}
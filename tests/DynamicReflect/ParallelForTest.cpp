@@ -0,0 +1,165 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Batch/WorkStealingPool.hpp>
+#include <TestCommon.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+
+// 调用线程上抛出的异常须在其他参与线程完成后才传播，之后的并行任务仍可使用工作线程；
+// 线程数可以在其他线程读取时修改
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// 等待Condition成立，超时返回false，避免测试在失败时挂起
+template <typename ConditionType>
+bool WaitFor(ConditionType&& Condition)
+{
+    const auto Deadline = Clock::now() + std::chrono::seconds(5);
+
+    while (!Condition())
+    {
+        if (Clock::now() > Deadline)
+        {
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+void CheckException(NekiraReflect::WorkStealingPool& Pool)
+{
+    const std::thread::id Caller = std::this_thread::get_id();
+
+    std::atomic<int> InFlight{0};
+    std::atomic<int> WorkerChunks{0};
+    bool             bCaught = false;
+
+    NekiraReflect::ParallelOptions Options;
+    Options.GrainSize = 1;
+    Options.MaxThreads = 2;
+
+    try
+    {
+        // 调用线程等到工作线程开始处理后才抛出异常，工作线程的块在此之后仍在执行
+        Pool.ParallelFor(64, Options,
+                         [&](size_t, size_t)
+                         {
+                             if (std::this_thread::get_id() == Caller)
+                             {
+                                 WaitFor([&] { return InFlight.load() > 0; });
+                                 throw std::runtime_error("chunk failed");
+                             }
+
+                             ++InFlight;
+                             std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                             ++WorkerChunks;
+                             --InFlight;
+                         });
+    }
+    catch (const std::runtime_error&)
+    {
+        bCaught = true;
+    }
+
+    NEKIRA_CHECK(bCaught);
+    NEKIRA_CHECK(InFlight.load() == 0);
+
+    // 其余的块不再被领取
+    NEKIRA_CHECK(WorkerChunks.load() < 32);
+}
+
+void CheckWorkersAfterException(NekiraReflect::WorkStealingPool& Pool)
+{
+    const std::thread::id Caller = std::this_thread::get_id();
+
+    std::atomic<bool> bWorkerRan{false};
+    bool              bOverlapped = true;
+
+    NekiraReflect::ParallelOptions Options;
+    Options.GrainSize = 1;
+    Options.MaxThreads = 2;
+
+    // 调用线程的标记未复位时任务会串行执行，第一块将等不到其他线程
+    Pool.ParallelFor(4, Options,
+                     [&](size_t Begin, size_t)
+                     {
+                         if (std::this_thread::get_id() != Caller)
+                         {
+                             bWorkerRan = true;
+                         }
+                         else if (Begin == 0 && !WaitFor([&] { return bWorkerRan.load(); }))
+                         {
+                             bOverlapped = false;
+                         }
+                     });
+
+    NEKIRA_CHECK(bOverlapped);
+}
+
+void CheckThreadCount(NekiraReflect::WorkStealingPool& Pool)
+{
+    std::atomic<bool> bDone{false};
+    size_t            MaxSeen = 0;
+
+    std::thread Reader(
+        [&]
+        {
+            while (!bDone.load())
+            {
+                MaxSeen = std::max(MaxSeen, Pool.GetThreadCount());
+            }
+        });
+
+    for (size_t Round = 0; Round < 20; ++Round)
+    {
+        Pool.SetThreadCount(2 + Round % 3);
+        Pool.ParallelFor(256, {}, [](size_t, size_t) {});
+    }
+
+    bDone = true;
+    Reader.join();
+
+    NEKIRA_CHECK(MaxSeen <= 4);
+}
+} // namespace
+
+int main()
+{
+    auto& Pool = NekiraReflect::WorkStealingPool::Get();
+    Pool.SetThreadCount(2);
+
+    CheckException(Pool);
+    CheckWorkersAfterException(Pool);
+    CheckThreadCount(Pool);
+
+    return NekiraTest::Finish();
+}
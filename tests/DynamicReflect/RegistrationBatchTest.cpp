@@ -0,0 +1,138 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <thread>
+#include <typeindex>
+
+
+// 批量作用域外的注册立即对所有线程可见；作用域内的注册在最外层作用域结束时发布，注册线程自己的查询总能命中
+namespace
+{
+struct EagerRecord
+{
+    int Value = 0;
+};
+
+struct BatchedRecord
+{
+    int Value = 0;
+};
+
+struct NestedRecord
+{
+    int Value = 0;
+};
+
+struct ModuleRecord
+{
+    int Value = 0;
+};
+
+template <typename Type>
+void RegisterRecord(const char* Name)
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<Type>(Name);
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &Type::Value));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+// 在另一个线程中查询，该线程不在批量作用域内
+bool VisibleFromOtherThread(std::type_index TypeIndex)
+{
+    bool bVisible = false;
+
+    std::thread Reader([&bVisible, TypeIndex]() {
+        bVisible = NekiraReflect::ReflectionRegistry::Get().GetClassInfo(TypeIndex) != nullptr;
+    });
+    Reader.join();
+
+    return bVisible;
+}
+
+void CheckEager()
+{
+    RegisterRecord<EagerRecord>("EagerRecord");
+
+    NEKIRA_CHECK(VisibleFromOtherThread(typeid(EagerRecord)));
+}
+
+void CheckBatch(NekiraReflect::ReflectionRegistry& Registry)
+{
+    {
+        NekiraReflect::ScopedRegistrationBatch Batch;
+
+        RegisterRecord<BatchedRecord>("BatchedRecord");
+
+        {
+            NekiraReflect::ScopedRegistrationBatch Nested;
+            RegisterRecord<NestedRecord>("NestedRecord");
+        }
+
+        // 内层作用域结束时不发布
+        NEKIRA_CHECK(!VisibleFromOtherThread(typeid(BatchedRecord)));
+        NEKIRA_CHECK(!VisibleFromOtherThread(typeid(NestedRecord)));
+
+        // 注册线程自己的查询会先发布再重试
+        NEKIRA_CHECK(Registry.GetClassInfoByName("NestedRecord") != nullptr);
+        NEKIRA_CHECK(VisibleFromOtherThread(typeid(NestedRecord)));
+    }
+
+    NEKIRA_CHECK(VisibleFromOtherThread(typeid(BatchedRecord)));
+    NEKIRA_CHECK(VisibleFromOtherThread(typeid(NestedRecord)));
+}
+
+void CheckModuleScope(NekiraReflect::ReflectionRegistry& Registry)
+{
+    const auto Module = Registry.CreateModule("BatchPlugin");
+
+    {
+        NekiraReflect::ScopedReflectionModule Scope(Module);
+
+        RegisterRecord<ModuleRecord>("ModuleRecord");
+
+        NEKIRA_CHECK(!VisibleFromOtherThread(typeid(ModuleRecord)));
+    }
+
+    // 模块作用域结束时一次发布
+    NEKIRA_CHECK(VisibleFromOtherThread(typeid(ModuleRecord)));
+
+    Registry.UnloadModule(Module);
+
+    NEKIRA_CHECK(!VisibleFromOtherThread(typeid(ModuleRecord)));
+}
+} // namespace
+
+int main()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    CheckEager();
+    CheckBatch(Registry);
+    CheckModuleScope(Registry);
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,163 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 定义后*_ACCESSOR_BEGIN宏会为每次RegisterReflection()记录统计
+#define NEKIRA_REFLECT_PROFILE_REGISTRATION
+
+#include <NekiraReflect/DynamicReflect/Accessor/ReflectAccessor.hpp>
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/RegistrationProfiler.hpp>
+#include <TestCommon.hpp>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+
+// 通过访问器宏注册已知类型后，统计结果中每个类型各有一条记录，耗时、元数据与堆分配计数符合预期
+NEKIRA_REFLECT_CLASS_ACCESSOR_DECL(ProfiledSmall)
+NEKIRA_REFLECT_CLASS_ACCESSOR_DECL(ProfiledLarge)
+
+class ProfiledSmall
+{
+public:
+    int Value = 0;
+};
+
+class ProfiledLarge
+{
+public:
+    int    Id = 0;
+    float  Weight = 0.0f;
+    double Score = 0.0;
+    bool   bEnabled = false;
+};
+
+// 在注册函数中停顿的时间，作为耗时的下限
+constexpr auto SlowRegistrationDelay = std::chrono::milliseconds(5);
+
+NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN(ProfiledSmall)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(Value)
+NEKIRA_REFLECT_CLASS_ACCESSOR_END()
+
+NEKIRA_REFLECT_CLASS_ACCESSOR_BEGIN(ProfiledLarge)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(Id)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(Weight)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(Score)
+NEKIRA_REFLECT_CLASS_ACCESSOR_VAR(bEnabled)
+std::this_thread::sleep_for(SlowRegistrationDelay);
+NEKIRA_REFLECT_CLASS_ACCESSOR_END()
+
+namespace
+{
+// 每次读取加一，使每条记录的堆分配次数恰好为1
+size_t FakeHeapCounter()
+{
+    static size_t Count = 0;
+    return ++Count;
+}
+
+const NekiraReflect::RegistrationRecord* FindRecord(const std::vector<NekiraReflect::RegistrationRecord>& Records,
+                                                    std::string_view Name)
+{
+    for (const auto& Record : Records)
+    {
+        if (Record.Name == Name)
+        {
+            return &Record;
+        }
+    }
+
+    return nullptr;
+}
+
+void CheckRecords(NekiraReflect::ReflectionRegistry& Registry)
+{
+    Registry.ClearRegistrationRecords();
+    NekiraReflect::SetHeapAllocationCounter(&FakeHeapCounter);
+
+    NekiraReflect::ReflectionAccessor<ProfiledSmall>::RegisterReflection();
+    NekiraReflect::ReflectionAccessor<ProfiledLarge>::RegisterReflection();
+
+    NekiraReflect::SetHeapAllocationCounter(nullptr);
+
+    const auto Records = Registry.GetRegistrationRecords();
+
+    NEKIRA_CHECK(Records.size() == 2);
+
+    const auto* Small = FindRecord(Records, "ProfiledSmall");
+    const auto* Large = FindRecord(Records, "ProfiledLarge");
+
+    NEKIRA_CHECK(Small != nullptr && Large != nullptr);
+
+    if (Small == nullptr || Large == nullptr)
+    {
+        return;
+    }
+
+    // 停顿计入耗时
+    const auto DelayNs = std::chrono::duration_cast<std::chrono::nanoseconds>(SlowRegistrationDelay).count();
+    NEKIRA_CHECK(Large->WallTimeNs >= static_cast<uint64_t>(DelayNs));
+
+    // 每个成员至少一次内存池分配，成员多的类型分配次数与字节数更多
+    NEKIRA_CHECK(Small->MetadataAllocations >= 1);
+    NEKIRA_CHECK(Large->MetadataAllocations >= Small->MetadataAllocations + 3);
+    NEKIRA_CHECK(Large->MetadataBytes > Small->MetadataBytes);
+
+    NEKIRA_CHECK(Small->HeapAllocations == 1);
+    NEKIRA_CHECK(Large->HeapAllocations == 1);
+
+    // 注册结果与统计一致
+    NEKIRA_CHECK(Registry.GetClassInfo<ProfiledLarge>() != nullptr);
+}
+
+void CheckDump(NekiraReflect::ReflectionRegistry& Registry)
+{
+    // 导出按耗时从高到低排序，停顿的类型排在最前
+    std::ostringstream Csv;
+    NekiraReflect::DumpRegistrationProfile(Csv, NekiraReflect::ProfileDumpFormat::CSV);
+
+    const auto CsvText = Csv.str();
+    NEKIRA_CHECK(CsvText.rfind("Name,WallTimeNs,MetadataBytes,MetadataAllocations,HeapAllocations\nProfiledLarge,", 0) == 0);
+    NEKIRA_CHECK(CsvText.find("\nProfiledSmall,") != std::string::npos);
+
+    std::ostringstream Json;
+    NekiraReflect::DumpRegistrationProfile(Json, NekiraReflect::ProfileDumpFormat::JSON);
+    NEKIRA_CHECK(Json.str().find("{\"Name\": \"ProfiledLarge\", \"WallTimeNs\": ") != std::string::npos);
+
+    // 清空后不再有记录
+    Registry.ClearRegistrationRecords();
+    NEKIRA_CHECK(Registry.GetRegistrationRecords().empty());
+}
+} // namespace
+
+int main()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    CheckRecords(Registry);
+    CheckDump(Registry);
+
+    return NekiraTest::Finish();
+}
@@ -0,0 +1,167 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <vector>
+
+
+// 读者并发查询的同时，写者反复注册类型、加载与卸载模块
+// [INFO] 以-fsanitize=thread构建时可检查快照发布与回收中的数据竞争
+namespace
+{
+struct StressRecord
+{
+    int         Value = 0;
+    std::string Name;
+};
+
+struct StressLateRecord
+{
+    double Weight = 0.0;
+};
+
+struct StressPluginRecord
+{
+    int Value = 0;
+};
+
+constexpr int ReaderCount = 3;
+constexpr int WriterRounds = 200;
+
+void RegisterStressRecord()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<StressRecord>("StressRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &StressRecord::Value));
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Name", &StressRecord::Name));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+void RegisterLateRecord()
+{
+    auto ClassInfo = NekiraReflect::MakeClassTypeInfo<StressLateRecord>("StressLateRecord");
+    ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Weight", &StressLateRecord::Weight));
+    NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+}
+
+void RunWriter(std::atomic<bool>& bDone)
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    for (int Round = 0; Round < WriterRounds; ++Round)
+    {
+        const NekiraReflect::ModuleHandle Module = Registry.CreateModule("StressPlugin");
+
+        {
+            NekiraReflect::ScopedReflectionModule Scope(Module);
+
+            auto ClassInfo = NekiraReflect::MakeClassTypeInfo<StressPluginRecord>("StressPluginRecord");
+            ClassInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &StressPluginRecord::Value));
+            NekiraReflect::RegisterClassInfo(std::move(ClassInfo));
+        }
+
+        // 主模块中的类型被反复替换与移除
+        if (Round % 2 == 0)
+        {
+            RegisterLateRecord();
+        }
+        else
+        {
+            Registry.RemoveClass(std::type_index(typeid(StressLateRecord)));
+        }
+
+        Registry.UnloadModule(Module);
+    }
+
+    bDone.store(true, std::memory_order_release);
+}
+
+void RunReader(const std::atomic<bool>& bDone, std::atomic<int>& Failures)
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    uint64_t LastGeneration = 0;
+
+    while (!bDone.load(std::memory_order_acquire))
+    {
+        const uint64_t Generation = Registry.GetGeneration();
+
+        const auto* ByType = Registry.GetClassInfo<StressRecord>();
+        const auto* ByName = Registry.GetClassInfoByName("StressRecord");
+
+        // 模块与被反复替换的类型只检查能否查询，不解引用，其TypeInfo可能在查询返回后被释放
+        const bool bPluginFound = Registry.GetClassInfoByName("StressPluginRecord") != nullptr;
+        const bool bLateFound = Registry.GetClassInfo<StressLateRecord>() != nullptr;
+        static_cast<void>(bPluginFound);
+        static_cast<void>(bLateFound);
+
+        if (ByType == nullptr || ByType != ByName || Generation < LastGeneration ||
+            ByType->GetVariable("Value")->GetTypeIndex() != std::type_index(typeid(int)))
+        {
+            Failures.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        LastGeneration = Generation;
+    }
+}
+} // namespace
+
+int main()
+{
+    RegisterStressRecord();
+
+    std::atomic<bool> bDone{false};
+    std::atomic<int>  Failures{0};
+
+    std::vector<std::thread> Readers;
+
+    for (int Index = 0; Index < ReaderCount; ++Index)
+    {
+        Readers.emplace_back(RunReader, std::cref(bDone), std::ref(Failures));
+    }
+
+    std::thread Writer(RunWriter, std::ref(bDone));
+
+    Writer.join();
+
+    for (auto& Reader : Readers)
+    {
+        Reader.join();
+    }
+
+    NEKIRA_CHECK(Failures.load() == 0);
+
+    // 写者结束后模块的类型已移除，主模块的类型保持不变
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    NEKIRA_CHECK(Registry.GetClassInfoByName("StressPluginRecord") == nullptr);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("StressRecord") == Registry.GetClassInfo<StressRecord>());
+
+    return NekiraTest::Finish();
+}
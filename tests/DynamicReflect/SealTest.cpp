@@ -0,0 +1,150 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraReflect/DynamicReflect/Core/Core.hpp>
+#include <NekiraReflect/DynamicReflect/Registry/ReflectionRegistry.hpp>
+#include <TestCommon.hpp>
+#include <typeindex>
+
+
+// 封存后按std::type_index、TypeId与名称查询均命中，未注册的类型与名称不命中，封存后的注册与移除仍然生效
+namespace
+{
+struct SealedPoint
+{
+    int X = 0;
+    int Y = 0;
+};
+
+struct SealedColor
+{
+    float R = 0.0f;
+    float G = 0.0f;
+    float B = 0.0f;
+};
+
+struct LateRegistered
+{
+    double Value = 0.0;
+};
+
+struct NeverSealed
+{
+    int Value = 0;
+};
+
+enum class SealedShape
+{
+    Circle,
+    Square
+};
+
+void RegisterTypes()
+{
+    auto PointInfo = NekiraReflect::MakeClassTypeInfo<SealedPoint>("SealedPoint");
+    PointInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("X", &SealedPoint::X));
+    PointInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Y", &SealedPoint::Y));
+    NekiraReflect::RegisterClassInfo(std::move(PointInfo));
+
+    auto ColorInfo = NekiraReflect::MakeClassTypeInfo<SealedColor>("SealedColor");
+    ColorInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("R", &SealedColor::R));
+    NekiraReflect::RegisterClassInfo(std::move(ColorInfo));
+
+    auto ShapeInfo = NekiraReflect::MakeEnumTypeInfo<SealedShape>("SealedShape");
+    ShapeInfo->AddEnumValue("Circle", static_cast<int64_t>(SealedShape::Circle));
+    ShapeInfo->AddEnumValue("Square", static_cast<int64_t>(SealedShape::Square));
+    NekiraReflect::RegisterEnumInfo(std::move(ShapeInfo));
+}
+
+void CheckHits(NekiraReflect::ReflectionRegistry& Registry)
+{
+    const auto* PointInfo = Registry.GetClassInfo(std::type_index(typeid(SealedPoint)));
+    const auto* ColorInfo = Registry.GetClassInfo(std::type_index(typeid(SealedColor)));
+    const auto* ShapeInfo = Registry.GetEnumInfo(std::type_index(typeid(SealedShape)));
+
+    NEKIRA_CHECK(PointInfo != nullptr && PointInfo->GetName() == "SealedPoint");
+    NEKIRA_CHECK(ColorInfo != nullptr && ColorInfo->GetName() == "SealedColor");
+    NEKIRA_CHECK(ShapeInfo != nullptr && ShapeInfo->GetName() == "SealedShape");
+
+    NEKIRA_CHECK(Registry.GetClassInfo<SealedPoint>() == PointInfo);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("SealedPoint") == PointInfo);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("SealedColor") == ColorInfo);
+    NEKIRA_CHECK(Registry.GetEnumInfo<SealedShape>() == ShapeInfo);
+    NEKIRA_CHECK(Registry.GetEnumInfoByName("SealedShape") == ShapeInfo);
+}
+
+void CheckMisses(NekiraReflect::ReflectionRegistry& Registry)
+{
+    NEKIRA_CHECK(Registry.GetClassInfo(std::type_index(typeid(NeverSealed))) == nullptr);
+    NEKIRA_CHECK(Registry.GetEnumInfo(std::type_index(typeid(NeverSealed))) == nullptr);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("NeverSealed") == nullptr);
+    NEKIRA_CHECK(Registry.GetEnumInfoByName("NeverSealed") == nullptr);
+
+    // 类型与名称分属不同的表
+    NEKIRA_CHECK(Registry.GetEnumInfo(std::type_index(typeid(SealedPoint))) == nullptr);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("SealedShape") == nullptr);
+}
+
+void CheckAfterSeal(NekiraReflect::ReflectionRegistry& Registry)
+{
+    // 封存后注册的类型在查找表重建后可查询，已有类型不受影响
+    auto LateInfo = NekiraReflect::MakeClassTypeInfo<LateRegistered>("LateRegistered");
+    LateInfo->AddVariable(NekiraReflect::MakeMemberVarInfo("Value", &LateRegistered::Value));
+    NekiraReflect::RegisterClassInfo(std::move(LateInfo));
+
+    NEKIRA_CHECK(Registry.IsSealed());
+
+    const auto* LateClass = Registry.GetClassInfo(std::type_index(typeid(LateRegistered)));
+
+    NEKIRA_CHECK(LateClass != nullptr && LateClass->GetVariable("Value") != nullptr);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("LateRegistered") == LateClass);
+    CheckHits(Registry);
+
+    // 移除后不再命中
+    Registry.RemoveClass(std::type_index(typeid(SealedColor)));
+
+    NEKIRA_CHECK(Registry.GetClassInfo(std::type_index(typeid(SealedColor))) == nullptr);
+    NEKIRA_CHECK(Registry.GetClassInfoByName("SealedColor") == nullptr);
+    NEKIRA_CHECK(Registry.GetClassInfo<SealedPoint>() != nullptr);
+}
+} // namespace
+
+int main()
+{
+    auto& Registry = NekiraReflect::ReflectionRegistry::Get();
+
+    RegisterTypes();
+
+    NEKIRA_CHECK(!Registry.IsSealed());
+    CheckHits(Registry);
+
+    Registry.Seal();
+
+    NEKIRA_CHECK(Registry.IsSealed());
+    CheckHits(Registry);
+    CheckMisses(Registry);
+    CheckAfterSeal(Registry);
+
+    return NekiraTest::Finish();
+}